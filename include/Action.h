@@ -1,9 +1,11 @@
 #pragma once
 #include <string>
+#include "SyncEnums.h"
 
 struct Action {
     std::string pid;
     std::string type;
     std::string res;
     int cycle;
+    SyncAction kind = SyncAction::READ;   // `type` ya interpretado por el parser
 };
@@ -5,11 +5,13 @@
 #include "Resource.h"
 #include "Action.h"
 
-// Funciones para parsear líneas y cargar vectores
+// Funciones para parsear líneas y cargar vectores. Los errores de carga se
+// informan como "ruta:línea: motivo: texto".
+// threads == 0 → automático (en paralelo sólo para archivos grandes)
 Process    parseProcessLine(const std::string& line);
 Resource   parseResourceLine(const std::string& line);
 Action     parseActionLine(const std::string& line);
 
-std::vector<Process>  loadProcesses(const std::string& filepath);
-std::vector<Resource> loadResources(const std::string& filepath);
-std::vector<Action>   loadActions(const std::string& filepath);
\ No newline at end of file
+std::vector<Process>  loadProcesses(const std::string& filepath, unsigned threads = 0);
+std::vector<Resource> loadResources(const std::string& filepath, unsigned threads = 0);
+std::vector<Action>   loadActions(const std::string& filepath, unsigned threads = 0);
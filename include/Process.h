@@ -1,11 +1,41 @@
 #pragma once
+#include <cstdint>
 #include <string>
 #include <deque>
-#include <unordered_set>
+#include <vector>
 #include "SyncEnums.h"
 
-enum class SchedulingAlgo { FIFO, SJF, SRT, RR, PRIORITY };
-enum class ProcState { READY, RUNNING, BLOCKED };
+enum class SchedulingAlgo { FIFO, SJF, SRT, RR, PRIORITY, CFS, MLFQ };
+constexpr int SCHEDULING_ALGO_COUNT = 7;
+
+inline const char* schedulingAlgoName(SchedulingAlgo a) {
+    switch (a) {
+        case SchedulingAlgo::FIFO:     return "FIFO";
+        case SchedulingAlgo::SJF:      return "SJF";
+        case SchedulingAlgo::SRT:      return "SRT";
+        case SchedulingAlgo::RR:       return "RR";
+        case SchedulingAlgo::PRIORITY: return "PRIORITY";
+        case SchedulingAlgo::CFS:      return "CFS";
+        case SchedulingAlgo::MLFQ:     return "MLFQ";
+    }
+    return "?";
+}
+
+// Convierte un nombre (FIFO, SJF, SRT, RR, PRIORITY, CFS, MLFQ); false si no existe
+inline bool parseSchedulingAlgo(const std::string& name, SchedulingAlgo& out) {
+    for (int i = 0; i < SCHEDULING_ALGO_COUNT; ++i) {
+        SchedulingAlgo a = static_cast<SchedulingAlgo>(i);
+        if (name == schedulingAlgoName(a)) { out = a; return true; }
+    }
+    return false;
+}
+
+// Algoritmos cuyo resultado depende del quantum (en CFS es la granularidad
+// mínima; en MLFQ, el quantum del nivel 0, que se duplica en cada nivel)
+inline bool usesQuantum(SchedulingAlgo a) {
+    return a == SchedulingAlgo::RR || a == SchedulingAlgo::CFS || a == SchedulingAlgo::MLFQ;
+}
+enum class ProcState : uint8_t { READY, RUNNING, BLOCKED };
 
 struct Process {
     std::string pid;
@@ -16,8 +46,6 @@ struct Process {
     ProcState state = ProcState::READY;
     int remaining = 0;
     int completionTime = -1;
-
-    std::unordered_set<std::string> acquiredSemaphores;
 };
 
 struct Mutex {
@@ -30,4 +58,46 @@ struct Semaphore {
     int count;
     std::deque<std::pair<int, SyncAction>> waitQueue;
     Semaphore(int c = 0): count(c) {}
-};
\ No newline at end of file
+};
+
+// Lock de lectores/escritores: varios lectores a la vez o un escritor solo.
+// Quien no entra espera en la cola de su tipo con un turno de llegada (lo usa
+// RwPolicy::FAIR) y el ciclo en que se bloqueó.
+struct RwLock {
+    struct Waiter { int idx; int since; unsigned turn; };
+
+    RwPolicy           policy    = RwPolicy::FAIR;
+    int                writerIdx = -1;   // -1 = ningún escritor adentro
+    std::vector<int>   readers;          // lectores adentro
+    std::deque<Waiter> readQueue, writeQueue;
+    unsigned           nextTurn  = 0;
+
+    // Métricas, acumuladas a medida que cambia el lock
+    long long readerCycles  = 0;   // ∑ lectores adentro × ciclos, hasta lastChange
+    long long readCycles    = 0;   // ciclos con algún lector, hasta lastChange
+    int       lastChange    = 0;
+    int       maxReaders    = 0;
+    int       writes        = 0;   // escrituras concedidas
+    long long writerWait    = 0;   // ∑ ciclos que esperaron esas escrituras
+    int       maxWriterWait = 0;
+
+    explicit RwLock(RwPolicy p = RwPolicy::FAIR): policy(p) {}
+
+    bool free() const { return writerIdx < 0 && readers.empty(); }
+
+    // Lleva las métricas de lectura hasta `cycle`; va antes de cambiar `readers`
+    void settle(int cycle) {
+        readerCycles += (long long)readers.size() * (cycle - lastChange);
+        if (!readers.empty()) readCycles += cycle - lastChange;
+        lastChange = cycle;
+    }
+
+    // Lectores simultáneos en promedio mientras hubo alguno, hasta `cycle`
+    float avgReaders(int cycle) const {
+        long long span  = cycle > lastChange ? cycle - lastChange : 0;
+        long long sum   = readerCycles + (long long)readers.size() * span;
+        long long count = readCycles + (readers.empty() ? 0 : span);
+        return count ? (float)sum / count : 0.0f;
+    }
+    float avgWriterWait() const { return writes ? (float)writerWait / writes : 0.0f; }
+};
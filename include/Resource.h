@@ -1,7 +1,13 @@
 #pragma once
 #include <string>
+#include "SyncEnums.h"
 
+// Capacidad 1 → mutex; otra → semáforo con ese valor inicial. Un lock de
+// lectores/escritores se declara con su política en lugar de la capacidad
+// ("BD, RW_FAIR") y no usa `count`.
 struct Resource {
     std::string name;
     int count;
+    bool     rwLock   = false;
+    RwPolicy rwPolicy = RwPolicy::FAIR;
 };
@@ -1,4 +1,5 @@
 #pragma once
+#include <string>
 
 // Resultado de un intento de sincronización
 enum class SyncResult {
@@ -14,5 +15,58 @@ enum class SyncAction {
     RELEASE,
     WAIT,
     SIGNAL,
-    WAKE
-};
\ No newline at end of file
+    WAKE,
+    DEADLOCK   // lo emite el motor: el proceso quedó en un interbloqueo
+};
+
+inline const char* syncActionName(SyncAction a) {
+    switch (a) {
+        case SyncAction::READ:    return "READ";
+        case SyncAction::WRITE:   return "WRITE";
+        case SyncAction::ADQUIRE: return "ADQUIRE";
+        case SyncAction::RELEASE: return "RELEASE";
+        case SyncAction::WAIT:    return "WAIT";
+        case SyncAction::SIGNAL:  return "SIGNAL";
+        case SyncAction::WAKE:    return "WAKE";
+        case SyncAction::DEADLOCK: return "DEADLOCK";
+    }
+    return "?";
+}
+
+inline const char* syncResultName(SyncResult r) {
+    return r == SyncResult::ACCESSED ? "ACCESSED" : "WAITING";
+}
+
+// Convierte el nombre usado en actions.txt; false si no es una acción válida
+inline bool parseSyncAction(const std::string& name, SyncAction& out) {
+    for (SyncAction a : { SyncAction::READ, SyncAction::WRITE, SyncAction::ADQUIRE,
+                          SyncAction::RELEASE, SyncAction::WAIT, SyncAction::SIGNAL }) {
+        if (name == syncActionName(a)) { out = a; return true; }
+    }
+    return false;
+}
+
+// Política de un lock de lectores/escritores: a quién se le da el lock
+// cuando hay lectores y escritores esperando
+enum class RwPolicy {
+    READERS,   // un lector entra siempre que no haya un escritor adentro
+    WRITERS,   // un escritor esperando frena a los lectores que llegan
+    FAIR       // por orden de llegada; los lectores seguidos entran juntos
+};
+
+inline const char* rwPolicyName(RwPolicy p) {
+    switch (p) {
+        case RwPolicy::READERS: return "RW_READERS";
+        case RwPolicy::WRITERS: return "RW_WRITERS";
+        case RwPolicy::FAIR:    return "RW_FAIR";
+    }
+    return "?";
+}
+
+// Convierte el nombre usado en resources.txt; false si no es una política
+inline bool parseRwPolicy(const std::string& name, RwPolicy& out) {
+    for (RwPolicy p : { RwPolicy::READERS, RwPolicy::WRITERS, RwPolicy::FAIR }) {
+        if (name == rwPolicyName(p)) { out = p; return true; }
+    }
+    return false;
+}
@@ -1,82 +1,206 @@
 #include "Parser.h"
-#include <fstream>
-#include <sstream>
+#include "io/MappedFile.h"
+#include <algorithm>
+#include <charconv>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
 
-// Función genérica para partir una línea por comas y eliminar espacios
-static std::vector<std::string> split(const std::string& line) {
-    std::vector<std::string> elems;
-    std::stringstream ss(line);
-    std::string item;
-    while (std::getline(ss, item, ',')) {
-        // recorta espacios al inicio y final
-        const auto l = item.find_first_not_of(" \t");
-        const auto r = item.find_last_not_of(" \t");
-        elems.push_back(item.substr(l, r - l + 1));
+// Los archivos se proyectan en memoria y se tokenizan en el lugar: cada campo
+// es un string_view sobre el buffer y los enteros se leen con from_chars. Sólo
+// se copian los campos de texto que terminan en el resultado.
+
+namespace {
+
+// Archivos a partir de este tamaño se parsean por bloques en paralelo
+constexpr size_t PARALLEL_MIN_BYTES = 8u << 20;
+
+std::string_view trim(std::string_view s) {
+    const auto l = s.find_first_not_of(" \t\r");
+    if (l == std::string_view::npos) return {};
+    const auto r = s.find_last_not_of(" \t\r");
+    return s.substr(l, r - l + 1);
+}
+
+// Parte la línea por comas y recorta espacios. Devuelve la cantidad real de
+// campos (puede ser mayor que N; sólo se guardan los N primeros).
+template <size_t N>
+size_t split(std::string_view line, std::string_view (&out)[N]) {
+    size_t n = 0;
+    while (true) {
+        const auto comma = line.find(',');
+        if (n < N) out[n] = trim(line.substr(0, comma));
+        n++;
+        if (comma == std::string_view::npos) return n;
+        line.remove_prefix(comma + 1);
     }
-    return elems;
 }
 
-std::vector<Process> loadProcesses(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open()) throw std::runtime_error("No se pudo abrir " + path);
-
-    std::vector<Process> list;
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        auto tokens = split(line);
-        if (tokens.size() != 4)
-            throw std::runtime_error("Formato inválido en procesos: " + line);
-
-        Process p;
-        p.pid      = tokens[0];
-        p.burst    = std::stoi(tokens[1]);
-        p.arrival  = std::stoi(tokens[2]);
-        p.priority = std::stoi(tokens[3]);
-        list.push_back(p);
+bool toInt(std::string_view s, int& out) {
+    if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+    const char* end = s.data() + s.size();
+    auto r = std::from_chars(s.data(), end, out);
+    return r.ec == std::errc() && r.ptr == end && !s.empty();
+}
+
+// Cada parser de línea devuelve nullptr si la línea es válida o el mensaje
+// de error en caso contrario
+const char* parseProcess(std::string_view line, Process& p) {
+    std::string_view f[4];
+    if (split(line, f) != 4 || f[0].empty()) return "Formato inválido en procesos";
+    if (!toInt(f[1], p.burst) || !toInt(f[2], p.arrival) || !toInt(f[3], p.priority))
+        return "Número inválido en procesos";
+    p.pid.assign(f[0]);
+    return nullptr;
+}
+
+const char* parseResource(std::string_view line, Resource& r) {
+    std::string_view f[2];
+    if (split(line, f) != 2 || f[0].empty()) return "Formato inválido en recursos";
+    r.rwLock = !toInt(f[1], r.count);
+    if (r.rwLock) {
+        // en lugar de la capacidad, la política de un lock de lectores/escritores
+        if (!parseRwPolicy(std::string(f[1]), r.rwPolicy)) return "Número inválido en recursos";
+        r.count = 1;
+    } else if (r.count < 0) {
+        return "Número inválido en recursos";
     }
-    return list;
+    r.name.assign(f[0]);
+    return nullptr;
 }
 
-std::vector<Resource> loadResources(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open()) throw std::runtime_error("No se pudo abrir " + path);
-
-    std::vector<Resource> list;
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        auto tokens = split(line);
-        if (tokens.size() != 2)
-            throw std::runtime_error("Formato inválido en recursos: " + line);
-
-        Resource r;
-        r.name    = tokens[0];
-        r.count   = std::stoi(tokens[1]);
-        list.push_back(r);
+const char* parseAction(std::string_view line, Action& a) {
+    std::string_view f[4];
+    if (split(line, f) != 4 || f[0].empty() || f[2].empty())
+        return "Formato inválido en acciones";
+    if (!toInt(f[3], a.cycle)) return "Número inválido en acciones";
+    a.pid.assign(f[0]);
+    a.type.assign(f[1]);    // "READ", "ADQUIRE", ...
+    a.res.assign(f[2]);     // nombre del recurso
+    if (!parseSyncAction(a.type, a.kind)) return "Acción desconocida en acciones";
+    return nullptr;
+}
+
+// Resultado de parsear un bloque de líneas completas
+template <class T>
+struct Chunk {
+    std::string_view text;
+    std::vector<T>   items;
+    size_t           lines = 0;        // líneas del bloque
+    size_t           errorLine = 0;    // relativa al bloque (1-based); 0 = sin error
+    const char*      error = nullptr;
+    std::string_view errorText;
+};
+
+template <class T, class ParseLine>
+void parseChunk(Chunk<T>& c, ParseLine parseLine) {
+    std::string_view text = c.text;
+    c.lines = (size_t)std::count(text.begin(), text.end(), '\n') +
+              (!text.empty() && text.back() != '\n');
+    c.items.reserve(c.lines);
+
+    size_t lineNo = 0;
+    while (!text.empty()) {
+        const auto nl = text.find('\n');
+        std::string_view line = text.substr(0, nl);
+        text.remove_prefix(nl == std::string_view::npos ? text.size() : nl + 1);
+        lineNo++;
+
+        if (trim(line).empty()) continue;
+        T item;
+        if (const char* err = parseLine(line, item)) {
+            c.error     = err;
+            c.errorLine = lineNo;
+            c.errorText = trim(line);
+            return;
+        }
+        c.items.push_back(std::move(item));
     }
-    return list;
 }
 
-std::vector<Action> loadActions(const std::string& path) {
-    std::ifstream file(path);
-    if (!file.is_open()) throw std::runtime_error("No se pudo abrir " + path);
-
-    std::vector<Action> list;
-    std::string line;
-    while (std::getline(file, line)) {
-        if (line.empty()) continue;
-        auto tokens = split(line);
-        if (tokens.size() != 4)
-            throw std::runtime_error("Formato inválido en acciones: " + line);
-
-        Action a;
-        a.pid    = tokens[0];
-        a.type   = tokens[1];    // "READ" o "WRITE"
-        a.res    = tokens[2];    // nombre del recurso
-        a.cycle  = std::stoi(tokens[3]);
-        list.push_back(a);
+template <class T, class ParseLine>
+std::vector<T> loadFile(const std::string& path, unsigned threads, ParseLine parseLine) {
+    MappedFile file(path);
+    const std::string_view all = file.view();
+
+    if (threads == 0)
+        threads = all.size() >= PARALLEL_MIN_BYTES
+                ? std::max(1u, std::thread::hardware_concurrency()) : 1u;
+
+    // Bloques de líneas completas: cada corte se corre hasta después de un '\n'
+    std::vector<Chunk<T>> chunks(std::max<size_t>(1, std::min<size_t>(threads, all.size())));
+    size_t begin = 0;
+    for (size_t k = 0; k < chunks.size(); ++k) {
+        size_t end = all.size();
+        if (k + 1 < chunks.size()) {
+            end = std::max(begin, (k + 1) * all.size() / chunks.size());
+            const auto nl = all.find('\n', end);
+            end = nl == std::string_view::npos ? all.size() : nl + 1;
+        }
+        chunks[k].text = all.substr(begin, end - begin);
+        begin = end;
+    }
+
+    if (chunks.size() == 1) {
+        parseChunk(chunks[0], parseLine);
+    } else {
+        std::vector<std::thread> workers;
+        for (size_t k = 1; k < chunks.size(); ++k)
+            workers.emplace_back([&, k]{ parseChunk(chunks[k], parseLine); });
+        parseChunk(chunks[0], parseLine);
+        for (auto& t : workers) t.join();
     }
+
+    // El primer error en orden de archivo, con su número de línea absoluto
+    size_t firstLine = 1;
+    size_t total = 0;
+    for (const auto& c : chunks) {
+        if (c.error)
+            throw std::runtime_error(path + ":" + std::to_string(firstLine + c.errorLine - 1) +
+                                     ": " + c.error + ": " + std::string(c.errorText));
+        firstLine += c.lines;
+        total     += c.items.size();
+    }
+
+    if (chunks.size() == 1) return std::move(chunks[0].items);
+
+    std::vector<T> list;
+    list.reserve(total);
+    for (auto& c : chunks)
+        std::move(c.items.begin(), c.items.end(), std::back_inserter(list));
     return list;
 }
+
+template <class T, class ParseLine>
+T parseOne(const std::string& line, ParseLine parseLine) {
+    T item;
+    if (const char* err = parseLine(line, item))
+        throw std::runtime_error(std::string(err) + ": " + line);
+    return item;
+}
+
+} // namespace
+
+Process parseProcessLine(const std::string& line) {
+    return parseOne<Process>(line, parseProcess);
+}
+
+Resource parseResourceLine(const std::string& line) {
+    return parseOne<Resource>(line, parseResource);
+}
+
+Action parseActionLine(const std::string& line) {
+    return parseOne<Action>(line, parseAction);
+}
+
+std::vector<Process> loadProcesses(const std::string& path, unsigned threads) {
+    return loadFile<Process>(path, threads, parseProcess);
+}
+
+std::vector<Resource> loadResources(const std::string& path, unsigned threads) {
+    return loadFile<Resource>(path, threads, parseResource);
+}
+
+std::vector<Action> loadActions(const std::string& path, unsigned threads) {
+    return loadFile<Action>(path, threads, parseAction);
+}
@@ -5,7 +5,12 @@
 #include "Resource.h"
 #include "Action.h"
 
-// Declaraciones
-std::vector<Process>  loadProcesses(const std::string& path);
-std::vector<Resource> loadResources(const std::string& path);
-std::vector<Action>   loadActions(const std::string& path);
+// Declaraciones. Los errores se informan como "ruta:línea: motivo: texto".
+// threads == 0 → automático (en paralelo sólo para archivos grandes)
+Process    parseProcessLine(const std::string& line);
+Resource   parseResourceLine(const std::string& line);
+Action     parseActionLine(const std::string& line);
+
+std::vector<Process>  loadProcesses(const std::string& path, unsigned threads = 0);
+std::vector<Resource> loadResources(const std::string& path, unsigned threads = 0);
+std::vector<Action>   loadActions(const std::string& path, unsigned threads = 0);
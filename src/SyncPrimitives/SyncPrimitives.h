@@ -2,24 +2,65 @@
 
 #include <string>
 #include <deque>
-#include <unordered_map>
+#include <vector>
 #include "Process.h"
 #include "SyncEnums.h"
 
+enum class ResourceKind { MUTEX, SEMAPHORE, RWLOCK };
+constexpr int RESOURCE_KIND_COUNT = 3;
+
+// Descripción fija de los recursos, indexada por id (posición en
+// resources.txt). Los nombres sólo se usan para mostrar.
+struct ResourceTable {
+    std::vector<std::string>  names;
+    std::vector<ResourceKind> kinds;
+    std::vector<int>          slots;      // id → posición en mutexes / semaphores / rwlocks
+    std::vector<int>          capacity;   // valor inicial de cada recurso
+    std::vector<RwPolicy>     rwPolicy;   // sólo cuenta en los RW locks
+
+    bool isMutex(int res)  const { return kinds[res] == ResourceKind::MUTEX; }
+    bool isRwLock(int res) const { return kinds[res] == ResourceKind::RWLOCK; }
+};
+
+// Estado de sincronización de una simulación. `table` apunta a la tabla del
+// workload compartido (inmutable), así que copiar esto sólo copia los mutex,
+// semáforos y RW locks.
 struct SyncPrimitives {
-    std::unordered_map<std::string, Mutex>    mutexes;
-    std::unordered_map<std::string, Semaphore> semaphores;
+    const ResourceTable*      table = nullptr;
+    std::vector<Mutex>        mutexes;
+    std::vector<Semaphore>    semaphores;
+    std::vector<RwLock>       rwlocks;
+
+    ResourceKind kind(int res) const { return table->kinds[res]; }
+    bool isMutex(int res)  const { return table->isMutex(res); }
+    bool isRwLock(int res) const { return table->isRwLock(res); }
+    const std::string& name(int res) const { return table->names[res]; }
+
+    Mutex&           mutex(int res)           { return mutexes[table->slots[res]]; }
+    const Mutex&     mutex(int res)     const { return mutexes[table->slots[res]]; }
+    Semaphore&       semaphore(int res)       { return semaphores[table->slots[res]]; }
+    const Semaphore& semaphore(int res) const { return semaphores[table->slots[res]]; }
+    RwLock&          rwlock(int res)          { return rwlocks[table->slots[res]]; }
+    const RwLock&    rwlock(int res)    const { return rwlocks[table->slots[res]]; }
+};
+
+// Acción ya resuelta a índices: proceso (posición en procs) y recurso
+struct SyncOp {
+    int        cycle;
+    int        proc;      // -1 si el PID no existe
+    int        res;       // < 0 si el recurso no está declarado
+    SyncAction type;
 };
 
 struct SyncEvent {
     int         cycle;    
     int         pidIdx;   
-    std::string res;      
+    int         res;      // id de recurso
     SyncResult  result;   
     SyncAction  action;   
 
-    SyncEvent(int c, int p, const std::string& r,
+    SyncEvent(int c, int p, int r,
               SyncResult rs, SyncAction a)
       : cycle(c), pidIdx(p), res(r), result(rs), action(a)
     {}
-};
\ No newline at end of file
+};
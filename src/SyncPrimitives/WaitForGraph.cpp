@@ -0,0 +1,101 @@
+#include "WaitForGraph.h"
+#include <algorithm>
+
+void WaitForGraph::reset(size_t procs, size_t resources) {
+    waits_.assign(procs, {});
+    holders_.assign(resources, {});
+    deadlocked_.assign(procs, 0);
+    signals_.assign(procs, {});
+    freeSignals_.assign(resources, 0);
+    seenProc_.assign(procs, 0);
+    seenRes_.assign(resources, 0);
+    stamp_ = 0;
+}
+
+void WaitForGraph::addWait(int proc, int res) {
+    if (!blocked(proc))
+        for (int r : signals_[proc]) freeSignals_[r]--;
+    waits_[proc].push_back(res);
+}
+
+void WaitForGraph::wake(int proc) {
+    if (blocked(proc))
+        for (int r : signals_[proc]) freeSignals_[r]++;
+    waits_[proc].clear();
+    deadlocked_[proc] = 0;
+}
+
+void WaitForGraph::addSignal(int proc, int res) {
+    signals_[proc].push_back(res);
+    if (!blocked(proc)) freeSignals_[res]++;
+}
+
+void WaitForGraph::dropSignal(int proc, int res) {
+    std::vector<int>& s = signals_[proc];
+    auto pos = std::find(s.begin(), s.end(), res);
+    if (pos == s.end()) return;
+    *pos = s.back();
+    s.pop_back();
+    if (!blocked(proc)) freeSignals_[res]--;
+}
+
+bool WaitForGraph::removeHolder(int res, int proc) {
+    std::vector<int>& h = holders_[res];
+    auto pos = std::find(h.begin(), h.end(), proc);
+    if (pos == h.end()) return false;
+    *pos = h.back();   // el orden de los dueños no importa
+    h.pop_back();
+    return true;
+}
+
+bool WaitForGraph::findDeadlock(int proc, const Pending& pending, std::vector<Edge>& out) {
+    out.clear();
+    if (!blocked(proc) || deadlocked(proc)) return false;
+
+    if (++stamp_ == 0) {   // la marca dio la vuelta
+        std::fill(seenProc_.begin(), seenProc_.end(), 0);
+        std::fill(seenRes_.begin(), seenRes_.end(), 0);
+        stamp_ = 1;
+    }
+
+    // DFS iterativo; corta en cuanto aparece alguien que puede avanzar, que
+    // es lo habitual (el dueño del recurso está corriendo)
+    stack_.assign(1, proc);
+    found_.clear();
+    seenProc_[proc] = stamp_;
+    while (!stack_.empty()) {
+        int p = stack_.back();
+        stack_.pop_back();
+        found_.push_back(p);
+        for (int r : waits_[p]) {
+            if (seenRes_[r] == stamp_) continue;
+            seenRes_[r] = stamp_;
+            const std::vector<int>& h = holders_[r];
+            for (int q : h)
+                if (!blocked(q)) return false;
+            if (freeSignals_[r] > 0) return false;
+            others_.clear();
+            if (pending(r, others_)) return false;
+            // nadie lo tiene ni lo va a devolver: espera perdida, no un nudo
+            if (h.empty() && others_.empty()) return false;
+            others_.insert(others_.end(), h.begin(), h.end());
+            for (int q : others_) {
+                // lo ya informado está trabado: no hace falta volver a recorrerlo
+                if (deadlocked(q) || seenProc_[q] == stamp_) continue;
+                seenProc_[q] = stamp_;
+                stack_.push_back(q);
+            }
+        }
+    }
+
+    // un proceso puede figurar varias veces en la misma cola: una arista
+    // por recurso alcanza
+    for (int p : found_) {
+        deadlocked_[p] = 1;
+        for (int r : waits_[p])
+            out.push_back({ p, r });
+    }
+    std::sort(out.begin(), out.end());
+    out.erase(std::unique(out.begin(), out.end()), out.end());
+    return true;
+}
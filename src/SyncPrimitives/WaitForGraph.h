@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+// Grafo de espera bipartito, mantenido a medida que los procesos se bloquean
+// y reciben recursos: proceso → recursos que espera, recurso → procesos que
+// tienen una unidad (el dueño de un mutex; uno por unidad tomada de un
+// semáforo). Un semáforo además lo puede devolver cualquiera que todavía
+// tenga un SIGNAL pendiente en la carga: se cuentan los de procesos que no
+// están bloqueados, así lo habitual (alguien libre lo va a dar) no recorre
+// nada. Lo demás que sólo sabe la carga lo aporta quien busca.
+class WaitForGraph {
+public:
+    // Participante de un interbloqueo: proceso y recurso que espera
+    using Edge = std::pair<int, int>;
+
+    void reset(size_t procs, size_t resources);
+
+    void addWait(int proc, int res);
+    // Recibió un recurso y vuelve a correr: aunque siga en otra cola de
+    // espera, ya no está bloqueado
+    void wake(int proc);
+    void addHolder(int res, int proc) { holders_[res].push_back(proc); }
+    // Devuelve una unidad; false si `proc` no tenía ninguna de `res`
+    bool removeHolder(int res, int proc);
+    // SIGNAL de `proc` sobre el semáforo `res` que todavía no pasó
+    void addSignal(int proc, int res);
+    void dropSignal(int proc, int res);
+
+    bool blocked(int proc)    const { return !waits_[proc].empty(); }
+    bool deadlocked(int proc) const { return deadlocked_[proc] != 0; }
+
+    const std::vector<int>& holders(int res) const { return holders_[res]; }
+    int freeSignals(int res) const { return freeSignals_[res]; }
+
+    // Lo que la carga todavía hace con `res` (sólo se pregunta si nadie libre
+    // lo puede devolver): true si se libera igual; si no, deja en `out` los
+    // procesos bloqueados con un SIGNAL pendiente sobre él
+    using Pending = std::function<bool(int res, std::vector<int>& out)>;
+
+    // Busca un interbloqueo nuevo que incluya a `proc`, recorriendo sólo lo
+    // alcanzable desde él: todos los procesos alcanzados esperan y cada
+    // recurso esperado sólo lo pueden devolver otros de ellos (un nudo; vale
+    // también para semáforos con varias unidades). Deja en `out` lo que no se
+    // había informado antes y lo marca; false si `proc` todavía puede avanzar
+    // o ya estaba informado.
+    bool findDeadlock(int proc, const Pending& pending, std::vector<Edge>& out);
+
+private:
+    std::vector<std::vector<int>> waits_;     // por proceso
+    std::vector<std::vector<int>> holders_;   // por recurso
+    std::vector<uint8_t>          deadlocked_;
+    std::vector<std::vector<int>> signals_;       // por proceso: semáforos con SIGNAL pendiente
+    std::vector<int>              freeSignals_;   // por recurso: de esos, de no bloqueados
+
+    // auxiliares de la búsqueda: visitado = marca de la búsqueda actual
+    std::vector<uint32_t> seenProc_, seenRes_;
+    uint32_t              stamp_ = 0;
+    std::vector<int>      stack_, found_, others_;
+};
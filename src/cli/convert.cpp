@@ -0,0 +1,69 @@
+#include "Parser.h"
+#include "io/BinaryWorkload.h"
+#include "workload/WorkloadGenerator.h"
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+// Conversor entre los archivos de texto (fuente editable) y el formato
+// binario columnar .llw.
+
+static void printUsage(const char* prog) {
+    std::cout <<
+        "Uso:\n"
+        "  " << prog << " to-bin  -p <procesos> -r <recursos> -a <acciones> -o <carga.llw>\n"
+        "  " << prog << " to-text -i <carga.llw> -o <directorio>\n";
+}
+
+int main(int argc, char** argv) {
+    try {
+        if (argc < 2) {
+            printUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+        std::string command = argv[1];
+        std::string procPath, resPath, actPath, inPath, outPath;
+
+        for (int i = 2; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc)
+                    throw std::runtime_error("Falta el valor de " + arg);
+                return argv[++i];
+            };
+
+            if      (arg == "-p") procPath = value();
+            else if (arg == "-r") resPath  = value();
+            else if (arg == "-a") actPath  = value();
+            else if (arg == "-i") inPath   = value();
+            else if (arg == "-o") outPath  = value();
+            else throw std::runtime_error("Opción desconocida: " + arg);
+        }
+
+        if (command == "-h" || command == "--help") {
+            printUsage(argv[0]);
+        } else if (command == "to-bin") {
+            if (procPath.empty() || resPath.empty() || actPath.empty() || outPath.empty())
+                throw std::runtime_error("to-bin necesita -p, -r, -a y -o");
+            writeBinaryWorkload(outPath, loadProcesses(procPath),
+                                loadResources(resPath), loadActions(actPath));
+        } else if (command == "to-text") {
+            if (inPath.empty() || outPath.empty())
+                throw std::runtime_error("to-text necesita -i y -o");
+            BinaryWorkload w(inPath);
+            FileSink sink(outPath + "/processes.txt",
+                          outPath + "/resources.txt",
+                          outPath + "/actions.txt");
+            for (const auto& r : w.resources()) sink.resource(r);
+            for (const auto& p : w.processes()) sink.process(p);
+            for (const auto& a : w.actions())   sink.action(a);
+        } else {
+            throw std::runtime_error("Comando desconocido: " + command);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,129 @@
+#include "workload/WorkloadGenerator.h"
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+
+// Generador de cargas sintéticas: escribe processes.txt, resources.txt y
+// actions.txt en el directorio indicado (mismo formato que data/).
+
+static void printUsage(const char* prog) {
+    std::cout <<
+        "Uso: " << prog << " [opciones]\n"
+        "      --seed <n>              semilla (1)\n"
+        "  -n, --processes <n>         cantidad de procesos (1000)\n"
+        "      --rate <r>              llegadas por ciclo, Poisson (0.5)\n"
+        "      --burst exp:<media>     ráfagas exponenciales (exp:8)\n"
+        "      --burst bimodal:<corta>:<larga>:<frac>\n"
+        "                              mezcla de dos exponenciales\n"
+        "      --max-burst <n>         tope de ráfaga (1000)\n"
+        "      --priorities <w0,w1..>  peso de cada prioridad (1,1,1,1,1)\n"
+        "      --mutexes <n>           cantidad de mutex (2)\n"
+        "      --semaphores <n>        cantidad de semáforos (2)\n"
+        "      --sem-count <n>         capacidad máxima de semáforo (4)\n"
+        "      --sections <m>          secciones críticas por proceso (1.0)\n"
+        "      --mutex-share <f>       fracción de secciones sobre mutex (0.5)\n"
+        "      --hot-share <f>         fracción sobre el recurso más disputado (0)\n"
+        "      --hold <m>              ciclos medios dentro de la sección (3)\n"
+        "      --exec-time             ciclos de acción según lo ejecutado (modo unified)\n"
+        "      --rwlocks <n>           cantidad de RW locks (0)\n"
+        "      --rw-policy <p>         RW_READERS, RW_WRITERS o RW_FAIR (RW_FAIR)\n"
+        "      --rw-share <f>          fracción de secciones sobre RW locks (0.5)\n"
+        "      --read-share <f>        fracción de lecturas en los RW locks (0.8)\n"
+        "  -o, --out-dir <dir>         directorio de salida (.)\n"
+        "  -h, --help\n";
+}
+
+static std::vector<std::string> splitOn(const std::string& s, char sep) {
+    std::vector<std::string> parts;
+    std::stringstream ss(s);
+    std::string item;
+    while (std::getline(ss, item, sep)) parts.push_back(item);
+    return parts;
+}
+
+int main(int argc, char** argv) {
+    try {
+        WorkloadConfig cfg;
+        std::string outDir = ".";
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc)
+                    throw std::runtime_error("Falta el valor de " + arg);
+                return argv[++i];
+            };
+
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return EXIT_SUCCESS;
+            } else if (arg == "--seed") {
+                cfg.seed = std::stoull(value());
+            } else if (arg == "-n" || arg == "--processes") {
+                cfg.processes = std::stoi(value());
+            } else if (arg == "--rate") {
+                cfg.arrivalRate = std::stod(value());
+            } else if (arg == "--burst") {
+                auto parts = splitOn(value(), ':');
+                if (parts.size() == 2 && parts[0] == "exp") {
+                    cfg.burstDist = WorkloadConfig::BurstDist::EXPONENTIAL;
+                    cfg.burstMean = std::stod(parts[1]);
+                } else if (parts.size() == 4 && parts[0] == "bimodal") {
+                    cfg.burstDist      = WorkloadConfig::BurstDist::BIMODAL;
+                    cfg.shortBurstMean = std::stod(parts[1]);
+                    cfg.longBurstMean  = std::stod(parts[2]);
+                    cfg.shortFraction  = std::stod(parts[3]);
+                } else {
+                    throw std::runtime_error("Distribución de ráfagas inválida");
+                }
+            } else if (arg == "--max-burst") {
+                cfg.maxBurst = std::stoi(value());
+            } else if (arg == "--priorities") {
+                cfg.priorityWeights.clear();
+                for (const auto& w : splitOn(value(), ','))
+                    cfg.priorityWeights.push_back(std::stod(w));
+            } else if (arg == "--mutexes") {
+                cfg.mutexes = std::stoi(value());
+            } else if (arg == "--semaphores") {
+                cfg.semaphores = std::stoi(value());
+            } else if (arg == "--sem-count") {
+                cfg.semaphoreMaxCount = std::stoi(value());
+            } else if (arg == "--sections") {
+                cfg.sectionsPerProcess = std::stod(value());
+            } else if (arg == "--mutex-share") {
+                cfg.mutexShare = std::stod(value());
+            } else if (arg == "--hot-share") {
+                cfg.hotShare = std::stod(value());
+            } else if (arg == "--hold") {
+                cfg.holdMean = std::stod(value());
+            } else if (arg == "--exec-time") {
+                cfg.execTime = true;
+            } else if (arg == "--rwlocks") {
+                cfg.rwLocks = std::stoi(value());
+            } else if (arg == "--rw-policy") {
+                std::string name = value();
+                if (!parseRwPolicy(name, cfg.rwPolicy))
+                    throw std::runtime_error("Política de RW lock desconocida: " + name);
+            } else if (arg == "--rw-share") {
+                cfg.rwShare = std::stod(value());
+            } else if (arg == "--read-share") {
+                cfg.readShare = std::stod(value());
+            } else if (arg == "-o" || arg == "--out-dir") {
+                outDir = value();
+            } else {
+                throw std::runtime_error("Opción desconocida: " + arg);
+            }
+        }
+
+        FileSink sink(outDir + "/processes.txt",
+                      outDir + "/resources.txt",
+                      outDir + "/actions.txt");
+        generateWorkload(cfg, sink);
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,206 @@
+#include "Parser.h"
+#include "simulation/SimulationEngine.h"
+#include "io/Report.h"
+#include "io/BinaryWorkload.h"
+#include <memory>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <climits>
+#ifndef DATA_DIR
+#define DATA_DIR "./data"
+#endif
+
+// Simulación sin interfaz gráfica: carga las entradas, corre a máxima
+// velocidad (por eventos) y escribe métricas + calendario en JSON o CSV.
+
+static void printUsage(const char* prog) {
+    std::cout <<
+        "Uso: " << prog << " [opciones]\n"
+        "  -p, --processes <ruta>   procesos  (por defecto " DATA_DIR "/processes.txt)\n"
+        "  -r, --resources <ruta>   recursos  (por defecto " DATA_DIR "/resources.txt)\n"
+        "  -a, --actions <ruta>     acciones  (por defecto " DATA_DIR "/actions.txt)\n"
+        "  -w, --workload <ruta>    carga binaria .llw (reemplaza -p/-r/-a)\n"
+        "      --algo <nombre>      FIFO | SJF | SRT | RR | PRIORITY | CFS | MLFQ (FIFO)\n"
+        "      --quantum <n>        quantum de RR, granularidad de CFS, nivel 0 de MLFQ (1)\n"
+        "      --mlfq-boost <n>     ciclos entre boosts de MLFQ, 0 = nunca (100)\n"
+        "      --mode <modo>        scheduling | sync | unified (scheduling)\n"
+        "      --cores <n>          núcleos simulados (1)\n"
+        "      --balance <modo>     global | work-stealing (global)\n"
+        "      --format <fmt>       json | csv (json)\n"
+        "      --max-cycles <n>     corta la simulación en ese ciclo\n"
+        "      --sweep <min>:<max>  barre todos los algoritmos (quantum en el rango)\n"
+        "      --threads <n>        hilos del barrido (todos los núcleos)\n"
+        "  -o, --out <ruta>         archivo de salida (stdout si se omite)\n"
+        "  -h, --help\n";
+}
+
+// Entero completo (sin restos) para la opción `opt`; el error la nombra
+static int parseIntOption(const std::string& opt, const std::string& text) {
+    try {
+        size_t used = 0;
+        int n = std::stoi(text, &used);
+        if (used == text.size()) return n;
+    } catch (const std::logic_error&) {
+        // invalid_argument u out_of_range: se informa abajo
+    }
+    throw std::runtime_error("Valor inválido para " + opt + ": " + text);
+}
+
+int main(int argc, char** argv) {
+    try {
+        std::string data_dir = DATA_DIR;
+        std::string procPath = data_dir + "/processes.txt";
+        std::string resPath  = data_dir + "/resources.txt";
+        std::string actPath  = data_dir + "/actions.txt";
+        std::string binPath;
+        std::string outPath;
+        SchedulingAlgo algo  = SchedulingAlgo::FIFO;
+        SimMode mode         = SimMode::SCHEDULING;
+        ReportFormat format  = ReportFormat::JSON;
+        int quantum          = 1;
+        int mlfqBoost        = 100;
+        int cores            = 1;
+        CoreBalancing balancing = CoreBalancing::GLOBAL;
+        int maxCycles        = INT_MAX - 1;
+        bool sweep           = false;
+        int sweepMin         = 1;
+        int sweepMax         = 1;
+        unsigned threads     = 0;
+
+        for (int i = 1; i < argc; ++i) {
+            std::string arg = argv[i];
+            auto value = [&]() -> std::string {
+                if (i + 1 >= argc)
+                    throw std::runtime_error("Falta el valor de " + arg);
+                return argv[++i];
+            };
+            auto intValue = [&]() { return parseIntOption(arg, value()); };
+
+            if (arg == "-h" || arg == "--help") {
+                printUsage(argv[0]);
+                return EXIT_SUCCESS;
+            } else if (arg == "-p" || arg == "--processes") {
+                procPath = value();
+            } else if (arg == "-r" || arg == "--resources") {
+                resPath = value();
+            } else if (arg == "-a" || arg == "--actions") {
+                actPath = value();
+            } else if (arg == "-w" || arg == "--workload") {
+                binPath = value();
+            } else if (arg == "-o" || arg == "--out") {
+                outPath = value();
+            } else if (arg == "--algo") {
+                std::string name = value();
+                if (!parseSchedulingAlgo(name, algo))
+                    throw std::runtime_error("Algoritmo desconocido: " + name);
+            } else if (arg == "--quantum") {
+                quantum = intValue();
+                if (quantum < 1)
+                    throw std::runtime_error("El quantum debe ser >= 1");
+            } else if (arg == "--mlfq-boost") {
+                mlfqBoost = intValue();
+            } else if (arg == "--mode") {
+                std::string name = value();
+                if      (name == "scheduling") mode = SimMode::SCHEDULING;
+                else if (name == "sync")       mode = SimMode::SYNCHRONIZATION;
+                else if (name == "unified")    mode = SimMode::UNIFIED;
+                else throw std::runtime_error("Modo desconocido: " + name);
+            } else if (arg == "--cores") {
+                cores = intValue();
+                if (cores < 1)
+                    throw std::runtime_error("Se necesita al menos un núcleo");
+            } else if (arg == "--balance") {
+                std::string name = value();
+                if (!parseCoreBalancing(name, balancing))
+                    throw std::runtime_error("Reparto desconocido: " + name);
+            } else if (arg == "--format") {
+                std::string name = value();
+                if      (name == "json") format = ReportFormat::JSON;
+                else if (name == "csv")  format = ReportFormat::CSV;
+                else throw std::runtime_error("Formato desconocido: " + name);
+            } else if (arg == "--max-cycles") {
+                maxCycles = intValue();
+                if (maxCycles < 0 || maxCycles > INT_MAX - 1)
+                    throw std::runtime_error("--max-cycles debe estar entre 0 y " +
+                                             std::to_string(INT_MAX - 1));
+            } else if (arg == "--sweep") {
+                std::string range = value();
+                size_t colon = range.find(':');
+                if (colon == std::string::npos)
+                    throw std::runtime_error("Rango de barrido inválido: " + range);
+                sweep    = true;
+                sweepMin = parseIntOption(arg, range.substr(0, colon));
+                sweepMax = parseIntOption(arg, range.substr(colon + 1));
+            } else if (arg == "--threads") {
+                int n = intValue();
+                if (n < 0)
+                    throw std::runtime_error("La cantidad de hilos debe ser >= 0");
+                threads = (unsigned)n;
+            } else {
+                throw std::runtime_error("Opción desconocida: " + arg);
+            }
+        }
+
+        std::unique_ptr<BinaryWorkload> binary;
+        if (!binPath.empty())
+            binary = std::make_unique<BinaryWorkload>(binPath);
+
+        if (sweep) {
+            SweepGrid grid;
+            for (int i = 0; i < SCHEDULING_ALGO_COUNT; ++i)
+                grid.algorithms.push_back(static_cast<SchedulingAlgo>(i));
+            grid.quantumMin = sweepMin;
+            grid.quantumMax = sweepMax;
+            grid.mode       = mode;
+            grid.cores      = cores;
+            grid.balancing  = balancing;
+            grid.mlfqBoostPeriod = mlfqBoost;
+            if (binary)
+                grid.workloads.push_back({ binPath, {}, {}, {},
+                                           CompiledWorkload::compile(*binary) });
+            else
+                grid.workloads.push_back({ procPath, loadProcesses(procPath),
+                                           loadResources(resPath), loadActions(actPath),
+                                           nullptr });
+
+            auto results = runSweep(grid, threads);
+            if (outPath.empty()) {
+                writeSweepReport(std::cout, grid, results, format);
+            } else {
+                std::ofstream out(outPath);
+                if (!out.is_open())
+                    throw std::runtime_error("No se pudo abrir " + outPath);
+                writeSweepReport(out, grid, results, format);
+            }
+            return EXIT_SUCCESS;
+        }
+
+        std::unique_ptr<SimulationEngine> sim;
+        if (binary)
+            sim = std::make_unique<SimulationEngine>(*binary, algo, quantum);
+        else
+            sim = std::make_unique<SimulationEngine>(loadProcesses(procPath), loadResources(resPath),
+                                                     loadActions(actPath), algo, quantum);
+        SimulationEngine& engine = *sim;
+        engine.setMode(mode);
+        engine.mlfqBoostPeriod_ = mlfqBoost;
+        engine.setCores(cores, balancing);
+        engine.runUntil(maxCycles);
+
+        if (outPath.empty()) {
+            writeReport(std::cout, engine, format);
+        } else {
+            std::ofstream out(outPath);
+            if (!out.is_open())
+                throw std::runtime_error("No se pudo abrir " + outPath);
+            writeReport(out, engine, format);
+        }
+
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
@@ -1,6 +1,10 @@
 #pragma once
 
+// UNIFIED corre el planificador y, sobre él, las acciones de sincronización:
+// cada acción se dispara según el tiempo ejecutado de su proceso y quien se
+// bloquea deja la CPU hasta que lo despierten
 enum class SimMode {
     SCHEDULING,
-    SYNCHRONIZATION
-};
\ No newline at end of file
+    SYNCHRONIZATION,
+    UNIFIED
+};
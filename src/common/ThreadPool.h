@@ -0,0 +1,46 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool fijo de hilos con una cola de tareas compartida. submit() devuelve un
+// std::future con el resultado de la tarea.
+class ThreadPool {
+public:
+    // threads == 0 → std::thread::hardware_concurrency()
+    explicit ThreadPool(unsigned threads = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&)            = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    template <class F>
+    auto submit(F&& f) -> std::future<decltype(f())> {
+        using R = decltype(f());
+        auto task = std::make_shared<std::packaged_task<R()>>(std::forward<F>(f));
+        std::future<R> result = task->get_future();
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            tasks_.emplace_back([task]{ (*task)(); });
+        }
+        cv_.notify_one();
+        return result;
+    }
+
+    unsigned size() const { return (unsigned)threads_.size(); }
+
+private:
+    void workerLoop();
+
+    std::vector<std::thread>          threads_;
+    std::deque<std::function<void()>> tasks_;
+    std::mutex                        mutex_;
+    std::condition_variable           cv_;
+    bool                              stop_ = false;
+};
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+// Traspaso sin bloqueos entre un escritor y un lector. El escritor llena
+// back() y lo publica; el lector toma con update() lo último publicado. Ninguno
+// espera al otro: si el escritor publica dos veces antes de que el lector
+// lea, la primera se descarta. Cada ranura se reutiliza, así que el escritor
+// debe sobrescribir todo lo que el lector vaya a mirar.
+template <class T>
+class TripleBuffer {
+public:
+    // Escritor
+    T&   back() { return slots_[back_]; }
+    void publish() {
+        back_ = middle_.exchange(back_ | DIRTY, std::memory_order_acq_rel) & INDEX;
+    }
+
+    // Lector: true si había algo nuevo desde el último update()
+    bool update() {
+        if (!(middle_.load(std::memory_order_relaxed) & DIRTY)) return false;
+        front_ = middle_.exchange(front_, std::memory_order_acq_rel) & INDEX;
+        return true;
+    }
+    const T& front() const { return slots_[front_]; }
+
+private:
+    static constexpr uint8_t INDEX = 3;
+    static constexpr uint8_t DIRTY = 4;
+
+    T                    slots_[3];
+    std::atomic<uint8_t> middle_{1};
+    uint8_t              back_  = 0;   // sólo del escritor
+    uint8_t              front_ = 2;   // sólo del lector
+};
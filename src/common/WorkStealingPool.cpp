@@ -0,0 +1,97 @@
+#include "WorkStealingPool.h"
+#include <algorithm>
+
+WorkStealingPool::WorkStealingPool(unsigned threads) {
+    if (threads == 0)
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    for (unsigned i = 0; i < threads; ++i)
+        queues_.push_back(std::make_unique<WorkerQueue>());
+    for (unsigned i = 0; i < threads; ++i)
+        threads_.emplace_back([this, i]{ workerLoop(i); });
+}
+
+WorkStealingPool::~WorkStealingPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& t : threads_) t.join();
+}
+
+void WorkStealingPool::parallelFor(size_t n, const Task& fn) {
+    if (n == 0) return;
+    const size_t workers = queues_.size();
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_     = &fn;
+        error_   = nullptr;
+        pending_ = n;
+
+        // Bloques contiguos: tareas vecinas (misma carga) caen en el mismo hilo
+        for (size_t w = 0; w < workers; ++w) {
+            std::lock_guard<std::mutex> q(queues_[w]->mutex);
+            for (size_t i = w * n / workers; i < (w + 1) * n / workers; ++i)
+                queues_[w]->items.push_back(i);
+        }
+        generation_++;
+    }
+    wake_.notify_all();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this]{ return pending_.load() == 0; });
+    job_ = nullptr;
+    if (error_) std::rethrow_exception(error_);
+}
+
+bool WorkStealingPool::popLocal(unsigned w, size_t& idx) {
+    auto& q = *queues_[w];
+    std::lock_guard<std::mutex> lock(q.mutex);
+    if (q.items.empty()) return false;
+    idx = q.items.front();
+    q.items.pop_front();
+    return true;
+}
+
+bool WorkStealingPool::steal(unsigned w, size_t& idx) {
+    const unsigned workers = (unsigned)queues_.size();
+    for (unsigned k = 1; k < workers; ++k) {
+        auto& q = *queues_[(w + k) % workers];
+        std::lock_guard<std::mutex> lock(q.mutex);
+        if (q.items.empty()) continue;
+        // se roba por el otro extremo para no competir con el dueño
+        idx = q.items.back();
+        q.items.pop_back();
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingPool::workerLoop(unsigned w) {
+    unsigned seen = 0;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]{ return stop_ || generation_ != seen; });
+            if (stop_) return;
+            seen = generation_;
+        }
+
+        // job_ se lee después de sacar el índice: un hilo rezagado puede
+        // tomar ya tareas del lote siguiente
+        size_t idx;
+        while (popLocal(w, idx) || steal(w, idx)) {
+            try {
+                (*job_.load())(idx, w);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                if (!error_) error_ = std::current_exception();
+            }
+            if (pending_.fetch_sub(1) == 1) {
+                std::lock_guard<std::mutex> lock(mutex_);
+                done_.notify_all();
+            }
+        }
+    }
+}
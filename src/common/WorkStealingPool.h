@@ -0,0 +1,58 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Pool de hilos con una cola por trabajador y robo de trabajo. Pensado para
+// lotes de tareas independientes y gruesas (p. ej. una simulación completa
+// por tarea): cada trabajador recorre su bloque de índices y, al vaciarlo,
+// roba del final del bloque de otro.
+class WorkStealingPool {
+public:
+    // fn(índice de la tarea, índice del trabajador)
+    using Task = std::function<void(size_t, unsigned)>;
+
+    // threads == 0 → std::thread::hardware_concurrency()
+    explicit WorkStealingPool(unsigned threads = 0);
+    ~WorkStealingPool();
+
+    WorkStealingPool(const WorkStealingPool&)            = delete;
+    WorkStealingPool& operator=(const WorkStealingPool&) = delete;
+
+    // Ejecuta fn(i, w) para todo i en [0, n) y espera a que terminen. Si
+    // alguna tarea lanza, se relanza aquí la primera excepción. No es
+    // reentrante: un solo parallelFor activo a la vez.
+    void parallelFor(size_t n, const Task& fn);
+
+    unsigned size() const { return (unsigned)threads_.size(); }
+
+private:
+    struct WorkerQueue {
+        std::mutex         mutex;
+        std::deque<size_t> items;
+    };
+
+    bool popLocal(unsigned w, size_t& idx);
+    bool steal(unsigned w, size_t& idx);
+    void workerLoop(unsigned w);
+
+    std::vector<std::unique_ptr<WorkerQueue>> queues_;
+    std::vector<std::thread>                  threads_;
+
+    std::mutex              mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    std::atomic<const Task*> job_{nullptr};   // se publica antes de repartir índices
+    std::atomic<size_t>     pending_{0};
+    unsigned                generation_ = 0;
+    bool                    stop_       = false;
+    std::exception_ptr      error_;
+};
@@ -0,0 +1,295 @@
+#include "BinaryWorkload.h"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <numeric>
+#include <stdexcept>
+#include <unordered_map>
+
+namespace {
+
+constexpr char     MAGIC[4]   = { 'L', 'L', 'W', 'K' };
+constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+
+uint64_t align8(uint64_t n) { return (n + 7) & ~uint64_t(7); }
+
+// Escritor secuencial de columnas con relleno hasta múltiplo de 8
+class ColumnWriter {
+public:
+    explicit ColumnWriter(std::ofstream& out) : out_(out) {}
+
+    template <class T>
+    uint64_t column(const std::vector<T>& v) {
+        const uint64_t off = pos_;
+        out_.write(reinterpret_cast<const char*>(v.data()), v.size() * sizeof(T));
+        pad(v.size() * sizeof(T));
+        return off;
+    }
+
+    uint64_t bytes(const std::string& s) {
+        const uint64_t off = pos_;
+        out_.write(s.data(), s.size());
+        pad(s.size());
+        return off;
+    }
+
+    void skip(uint64_t n) { pos_ += n; }
+
+private:
+    void pad(uint64_t n) {
+        static const char zeros[8] = {};
+        const uint64_t padded = align8(n);
+        out_.write(zeros, padded - n);
+        pos_ += padded;
+    }
+
+    std::ofstream& out_;
+    uint64_t       pos_ = 0;
+};
+
+} // namespace
+
+void writeBinaryWorkload(const std::string& path,
+                         const std::vector<Process>&  procs,
+                         const std::vector<Resource>& res,
+                         const std::vector<Action>&   acts)
+{
+    // Tabla de cadenas: cada nombre se guarda una vez por aparición en su tabla
+    std::vector<uint64_t> strOffsets{ 0 };
+    std::string           strBytes;
+    auto addString = [&](const std::string& s) {
+        strBytes += s;
+        strOffsets.push_back(strBytes.size());
+        return (uint32_t)(strOffsets.size() - 2);
+    };
+
+    // Mismas reglas de resolución que SimulationEngine: PID repetido → el
+    // primero; recurso repetido → el último
+    std::unordered_map<std::string, int> procIds, resIds;
+    std::vector<int32_t>  burst, arrival, priority, capacity;
+    std::vector<uint32_t> pidName, resName;
+    std::vector<uint8_t>  resLock;
+    for (int i = 0; i < (int)procs.size(); ++i) {
+        const Process& p = procs[i];
+        procIds.emplace(p.pid, i);
+        burst.push_back(p.burst);
+        arrival.push_back(p.arrival);
+        priority.push_back(p.priority);
+        pidName.push_back(addString(p.pid));
+    }
+    for (int i = 0; i < (int)res.size(); ++i) {
+        resIds[res[i].name] = i;
+        const Resource& r = res[i];
+        if (!r.rwLock && r.count < 0)
+            throw std::runtime_error("Capacidad negativa en el recurso " + r.name);
+        capacity.push_back(r.rwLock ? 1 : r.count);
+        resLock.push_back(r.rwLock ? (uint8_t)r.rwPolicy + 1 : 0);
+        resName.push_back(addString(r.name));
+    }
+
+    std::unordered_map<std::string, int> undeclPidIds, undeclResIds;
+    std::vector<uint32_t> undeclPid, undeclRes;
+    auto resolve = [&](const std::string& name,
+                       const std::unordered_map<std::string, int>& ids,
+                       std::unordered_map<std::string, int>& undeclIds,
+                       std::vector<uint32_t>& undecl) -> int32_t {
+        auto it = ids.find(name);
+        if (it != ids.end()) return it->second;
+        auto u = undeclIds.find(name);
+        if (u == undeclIds.end()) {
+            u = undeclIds.emplace(name, (int)undecl.size()).first;
+            undecl.push_back(addString(name));
+        }
+        return -(u->second + 1);
+    };
+
+    // Acciones ordenadas por ciclo (estable, como compileActions)
+    std::vector<size_t> order(acts.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+        [&](size_t a, size_t b){ return acts[a].cycle < acts[b].cycle; });
+
+    std::vector<int32_t> actCycle, actProc, actRes;
+    std::vector<uint8_t> actKind;
+    actCycle.reserve(acts.size());
+    actProc.reserve(acts.size());
+    actRes.reserve(acts.size());
+    actKind.reserve(acts.size());
+    for (size_t i : order) {
+        const Action& a = acts[i];
+        actCycle.push_back(a.cycle);
+        actProc.push_back(resolve(a.pid, procIds, undeclPidIds, undeclPid));
+        actRes.push_back(resolve(a.res, resIds, undeclResIds, undeclRes));
+        actKind.push_back((uint8_t)a.kind);
+    }
+
+    std::ofstream out(path, std::ios::binary);
+    if (!out.is_open()) throw std::runtime_error("No se pudo abrir " + path);
+
+    BinaryWorkload::Header h{};
+    std::memcpy(h.magic, MAGIC, sizeof MAGIC);
+    h.version        = BinaryWorkload::VERSION;
+    h.byteOrder      = BYTE_ORDER_MARK;
+    h.processes      = (uint32_t)procs.size();
+    h.resources      = (uint32_t)res.size();
+    h.undeclaredPids = (uint32_t)undeclPid.size();
+    h.undeclaredRes  = (uint32_t)undeclRes.size();
+    h.strings        = (uint32_t)(strOffsets.size() - 1);
+    h.actions        = acts.size();
+    h.stringBytes    = strBytes.size();
+
+    // Primero se reserva la cabecera y se escriben las columnas; al final se
+    // vuelve al inicio a escribir la cabecera con los offsets ya conocidos
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    ColumnWriter w(out);
+    w.skip(sizeof h);
+    static_assert(sizeof(BinaryWorkload::Header) % 8 == 0, "cabecera sin alinear");
+
+    h.offBurst      = w.column(burst);
+    h.offArrival    = w.column(arrival);
+    h.offPriority   = w.column(priority);
+    h.offPid        = w.column(pidName);
+    h.offCapacity   = w.column(capacity);
+    h.offResName    = w.column(resName);
+    h.offActCycle   = w.column(actCycle);
+    h.offActProc    = w.column(actProc);
+    h.offActRes     = w.column(actRes);
+    h.offActKind    = w.column(actKind);
+    h.offUndeclPid  = w.column(undeclPid);
+    h.offUndeclRes  = w.column(undeclRes);
+    h.offStrOffsets = w.column(strOffsets);
+    h.offStrBytes   = w.bytes(strBytes);
+    h.offResLock    = w.column(resLock);
+
+    out.seekp(0);
+    out.write(reinterpret_cast<const char*>(&h), sizeof h);
+    if (!out) throw std::runtime_error("Error al escribir " + path);
+}
+
+BinaryWorkload::BinaryWorkload(const std::string& path)
+    : file_(path)
+{
+    // Las versiones 1 y 2 tienen una cabecera más corta; lo que falta queda en 0
+    if (file_.size() < HEADER_V2_SIZE)
+        throw std::runtime_error(path + ": no es una carga binaria (archivo truncado)");
+    hdr_ = Header{};
+    std::memcpy(&hdr_, file_.data(), std::min<size_t>(file_.size(), sizeof hdr_));
+    if (hdr_.version < 3) hdr_.offResLock = 0;
+    validate(path);
+}
+
+// Comprueba que cada columna cae dentro del archivo y que los índices de las
+// acciones son válidos, para que los accesos posteriores no necesiten chequeo
+void BinaryWorkload::validate(const std::string& path) const {
+    auto fail = [&](const std::string& why) {
+        throw std::runtime_error(path + ": " + why);
+    };
+    if (std::memcmp(hdr_.magic, MAGIC, sizeof MAGIC) != 0)
+        fail("no es una carga binaria");
+    if (hdr_.byteOrder != BYTE_ORDER_MARK)
+        fail("orden de bytes distinto al de esta máquina");
+    if (hdr_.version < 1 || hdr_.version > VERSION)
+        fail("versión " + std::to_string(hdr_.version) + " no soportada");
+
+    const uint64_t size = file_.size();
+    auto inFile = [&](uint64_t off, uint64_t count, uint64_t width) {
+        if (off % 8 != 0 || off > size || count > (size - off) / width)
+            fail("columna fuera del archivo");
+    };
+    inFile(hdr_.offBurst,      hdr_.processes,      4);
+    inFile(hdr_.offArrival,    hdr_.processes,      4);
+    inFile(hdr_.offPriority,   hdr_.processes,      4);
+    inFile(hdr_.offPid,        hdr_.processes,      4);
+    inFile(hdr_.offCapacity,   hdr_.resources,      4);
+    inFile(hdr_.offResName,    hdr_.resources,      4);
+    inFile(hdr_.offActCycle,   hdr_.actions,        4);
+    inFile(hdr_.offActProc,    hdr_.actions,        4);
+    inFile(hdr_.offActRes,     hdr_.actions,        4);
+    inFile(hdr_.offActKind,    hdr_.actions,        1);
+    inFile(hdr_.offUndeclPid,  hdr_.undeclaredPids, 4);
+    inFile(hdr_.offUndeclRes,  hdr_.undeclaredRes,  4);
+    inFile(hdr_.offStrOffsets, (uint64_t)hdr_.strings + 1, 8);
+    inFile(hdr_.offStrBytes,   hdr_.stringBytes,    1);
+    if (hdr_.version >= 3) {
+        if (file_.size() < sizeof hdr_) fail("cabecera truncada");
+        inFile(hdr_.offResLock, hdr_.resources, 1);
+    }
+
+    const uint64_t* so = col<uint64_t>(hdr_.offStrOffsets);
+    for (uint32_t i = 0; i < hdr_.strings; ++i)
+        if (so[i] > so[i + 1] || so[i + 1] > hdr_.stringBytes)
+            fail("tabla de cadenas corrupta");
+
+    auto checkIds = [&](uint64_t off, uint32_t n) {
+        const uint32_t* ids = col<uint32_t>(off);
+        for (uint32_t i = 0; i < n; ++i)
+            if (ids[i] >= hdr_.strings) fail("id de cadena inválido");
+    };
+    checkIds(hdr_.offPid,       hdr_.processes);
+    checkIds(hdr_.offResName,   hdr_.resources);
+    checkIds(hdr_.offUndeclPid, hdr_.undeclaredPids);
+    checkIds(hdr_.offUndeclRes, hdr_.undeclaredRes);
+
+    // una cuenta (0 = semáforo de señalización) o un RW lock con una política
+    // conocida: en la versión 2 como capacidad negativa, desde la 3 en su columna
+    const int32_t* cap = capacity();
+    for (uint32_t i = 0; i < hdr_.resources; ++i) {
+        if (hdr_.version >= 3) {
+            if (cap[i] < 0) fail("capacidad inválida en recursos");
+            if (col<uint8_t>(hdr_.offResLock)[i] > (int)RwPolicy::FAIR + 1)
+                fail("lock inválido en recursos");
+            continue;
+        }
+        const bool rw = hdr_.version == 2 && cap[i] < 0 &&
+                        -(int64_t)cap[i] - 1 <= (int)RwPolicy::FAIR;
+        if (cap[i] < 0 && !rw) fail("capacidad inválida en recursos");
+    }
+
+    const int32_t* cyc  = actionCycle();
+    const int32_t* proc = actionProc();
+    const int32_t* res  = actionRes();
+    const uint8_t* kind = actionKind();
+    const int64_t np = hdr_.processes, nr = hdr_.resources;
+    for (uint64_t i = 0; i < hdr_.actions; ++i) {
+        if (i > 0 && cyc[i] < cyc[i - 1])               fail("acciones sin ordenar por ciclo");
+        if (proc[i] >= np || proc[i] < -(int64_t)hdr_.undeclaredPids) fail("proceso inválido en acciones");
+        if (res[i]  >= nr || res[i]  < -(int64_t)hdr_.undeclaredRes)  fail("recurso inválido en acciones");
+        if (kind[i] > (uint8_t)SyncAction::SIGNAL)      fail("tipo de acción inválido");
+    }
+}
+
+std::vector<Process> BinaryWorkload::processes() const {
+    std::vector<Process> list(processCount());
+    for (uint32_t i = 0; i < processCount(); ++i) {
+        list[i].pid.assign(pid(i));
+        list[i].burst    = burst()[i];
+        list[i].arrival  = arrival()[i];
+        list[i].priority = priority()[i];
+    }
+    return list;
+}
+
+std::vector<Resource> BinaryWorkload::resources() const {
+    std::vector<Resource> list(resourceCount());
+    for (uint32_t i = 0; i < resourceCount(); ++i) {
+        list[i].name.assign(resourceName(i));
+        list[i].rwLock = rwLock(i);
+        if (list[i].rwLock) list[i].rwPolicy = rwPolicy(i);
+        list[i].count = list[i].rwLock ? 1 : capacity()[i];
+    }
+    return list;
+}
+
+std::vector<Action> BinaryWorkload::actions() const {
+    std::vector<Action> list(actionCount());
+    for (uint64_t i = 0; i < actionCount(); ++i) {
+        Action& a = list[i];
+        const int32_t p = actionProc()[i], r = actionRes()[i];
+        a.pid.assign(p >= 0 ? pid(p) : undeclaredPid(-p - 1));
+        a.res.assign(r >= 0 ? resourceName(r) : undeclaredRes(-r - 1));
+        a.kind  = (SyncAction)actionKind()[i];
+        a.type  = syncActionName(a.kind);
+        a.cycle = actionCycle()[i];
+    }
+    return list;
+}
@@ -0,0 +1,122 @@
+#pragma once
+
+#include "Process.h"
+#include "Resource.h"
+#include "Action.h"
+#include "io/MappedFile.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Formato binario columnar de cargas (.llw), versión 3.
+//
+// Cabecera fija seguida de columnas alineadas a 8 bytes:
+//   procesos:  burst, arrival, priority (int32) y nombre (id de cadena, uint32)
+//   recursos:  capacidad (int32, >= 0), nombre y lock (uint8): 0 para un
+//              mutex/semáforo, p+1 para un lock de lectores/escritores con
+//              RwPolicy p. La versión 2 no tenía la columna lock y guardaba
+//              el RW lock como capacidad -(p+1); la versión 1 no tenía RW
+//              locks. Ambas se siguen leyendo.
+//   acciones:  cycle, proc, res (int32) y kind (uint8), ya ordenadas por ciclo
+//              (orden estable respecto del archivo de texto). proc y res son
+//              índices ya resueltos; los valores -(k+1) apuntan a la k-ésima
+//              entrada de las tablas de PIDs / recursos no declarados.
+//   cadenas:   offsets (uint64, n+1) y bytes concatenados, sin terminador.
+// Los enteros se guardan en el orden de bytes de la máquina que escribe; la
+// cabecera lleva una marca para rechazar archivos de otra arquitectura.
+
+// Convierte una carga en texto (ya parseada) al formato binario
+void writeBinaryWorkload(const std::string& path,
+                         const std::vector<Process>&  procs,
+                         const std::vector<Resource>& res,
+                         const std::vector<Action>&   acts);
+
+// Carga proyectada en memoria; las columnas se leen en el lugar. Lanza
+// std::runtime_error si el archivo no es válido.
+class BinaryWorkload {
+public:
+    static constexpr uint32_t VERSION = 3;   // se siguen leyendo la 1 y la 2
+
+    explicit BinaryWorkload(const std::string& path);
+
+    uint32_t processCount()  const { return hdr_.processes; }
+    uint32_t resourceCount() const { return hdr_.resources; }
+    uint64_t actionCount()   const { return hdr_.actions; }
+
+    const int32_t* burst()    const { return col<int32_t>(hdr_.offBurst); }
+    const int32_t* arrival()  const { return col<int32_t>(hdr_.offArrival); }
+    const int32_t* priority() const { return col<int32_t>(hdr_.offPriority); }
+    std::string_view pid(uint32_t i) const { return str(col<uint32_t>(hdr_.offPid)[i]); }
+
+    const int32_t* capacity() const { return col<int32_t>(hdr_.offCapacity); }
+    std::string_view resourceName(uint32_t i) const {
+        return str(col<uint32_t>(hdr_.offResName)[i]);
+    }
+    // Sea cual sea la versión del archivo
+    bool     rwLock(uint32_t i)   const { return lock(i) != 0; }
+    RwPolicy rwPolicy(uint32_t i) const { return (RwPolicy)(lock(i) - 1); }
+
+    const int32_t* actionCycle() const { return col<int32_t>(hdr_.offActCycle); }
+    const int32_t* actionProc()  const { return col<int32_t>(hdr_.offActProc); }
+    const int32_t* actionRes()   const { return col<int32_t>(hdr_.offActRes); }
+    const uint8_t* actionKind()  const { return col<uint8_t>(hdr_.offActKind); }
+
+    // Nombres citados en acciones sin declarar (índice k ↔ valor -(k+1))
+    uint32_t undeclaredPidCount() const { return hdr_.undeclaredPids; }
+    uint32_t undeclaredResCount() const { return hdr_.undeclaredRes; }
+    std::string_view undeclaredPid(uint32_t k) const {
+        return str(col<uint32_t>(hdr_.offUndeclPid)[k]);
+    }
+    std::string_view undeclaredRes(uint32_t k) const {
+        return str(col<uint32_t>(hdr_.offUndeclRes)[k]);
+    }
+
+    // Reconstruye los vectores de texto (para el conversor inverso)
+    std::vector<Process>  processes() const;
+    std::vector<Resource> resources() const;
+    std::vector<Action>   actions()   const;
+
+    // Cabecera en disco (los offsets son relativos al inicio del archivo)
+    struct Header {
+        char     magic[4];
+        uint32_t version;
+        uint32_t byteOrder;
+        uint32_t processes;
+        uint32_t resources;
+        uint32_t undeclaredPids;
+        uint32_t undeclaredRes;
+        uint32_t strings;
+        uint64_t actions;
+        uint64_t stringBytes;
+        uint64_t offBurst, offArrival, offPriority, offPid;
+        uint64_t offCapacity, offResName;
+        uint64_t offActCycle, offActProc, offActRes, offActKind;
+        uint64_t offUndeclPid, offUndeclRes;
+        uint64_t offStrOffsets, offStrBytes;
+        uint64_t offResLock;                   // desde la versión 3
+    };
+    // Tamaño de la cabecera en las versiones 1 y 2
+    static constexpr size_t HEADER_V2_SIZE = offsetof(Header, offResLock);
+
+private:
+    template <class T>
+    const T* col(uint64_t off) const {
+        return reinterpret_cast<const T*>(file_.data() + off);
+    }
+    std::string_view str(uint32_t id) const {
+        const uint64_t* o = col<uint64_t>(hdr_.offStrOffsets);
+        return { file_.data() + hdr_.offStrBytes + o[id], (size_t)(o[id + 1] - o[id]) };
+    }
+    // Columna lock de la versión 3, o su equivalente en las anteriores
+    int lock(uint32_t i) const {
+        if (hdr_.version >= 3) return col<uint8_t>(hdr_.offResLock)[i];
+        const int32_t cap = capacity()[i];
+        return hdr_.version == 2 && cap < 0 ? -cap : 0;
+    }
+    void validate(const std::string& path) const;
+
+    MappedFile file_;
+    Header     hdr_;
+};
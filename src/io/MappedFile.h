@@ -0,0 +1,27 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+// Archivo de sólo lectura proyectado en memoria (mmap). En plataformas sin
+// mmap se lee completo a un buffer. Lanza std::runtime_error si no se puede
+// abrir.
+class MappedFile {
+public:
+    explicit MappedFile(const std::string& path);
+    ~MappedFile();
+
+    MappedFile(const MappedFile&)            = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return data_; }
+    size_t      size() const { return size_; }
+    std::string_view view() const { return { data_, size_ }; }
+
+private:
+    const char* data_ = nullptr;
+    size_t      size_ = 0;
+    bool        mapped_ = false;
+    std::string buffer_;   // sólo sin mmap
+};
@@ -0,0 +1,265 @@
+#include "Report.h"
+#include <string>
+
+// Escapa una cadena para JSON (PIDs y nombres de recurso vienen del usuario)
+static std::string jsonStr(const std::string& s) {
+    std::string out = "\"";
+    for (char c : s) {
+        switch (c) {
+            case '"':  out += "\\\""; break;
+            case '\\': out += "\\\\"; break;
+            case '\n': out += "\\n";  break;
+            case '\t': out += "\\t";  break;
+            default:
+                if ((unsigned char)c < 0x20) continue;
+                out += c;
+        }
+    }
+    return out + "\"";
+}
+
+// En CSV se entrecomilla sólo si hace falta
+static std::string csvStr(const std::string& s) {
+    if (s.find_first_of(",\"\n") == std::string::npos) return s;
+    std::string out = "\"";
+    for (char c : s) {
+        if (c == '"') out += '"';
+        out += c;
+    }
+    return out + "\"";
+}
+
+static const char* modeName(SimMode m) {
+    switch (m) {
+        case SimMode::SCHEDULING:      return "scheduling";
+        case SimMode::SYNCHRONIZATION: return "synchronization";
+        default:                       return "unified";
+    }
+}
+
+// Ids de los RW locks, en el orden de resources.txt
+static std::vector<int> rwLockIds(const SimulationEngine& e) {
+    const ResourceTable& table = *e.syncState().table;
+    std::vector<int> ids;
+    for (int r = 0; r < (int)table.kinds.size(); ++r)
+        if (table.isRwLock(r)) ids.push_back(r);
+    return ids;
+}
+
+static void writeJson(std::ostream& out, const SimulationEngine& e) {
+    const Metrics& m = e.metrics();
+    const auto& procs = e.procs();
+
+    out << "{\n";
+    out << "  \"algorithm\": \"" << e.policyName() << "\",\n";
+    out << "  \"quantum\": " << e.rrQuantum_ << ",\n";
+    out << "  \"mode\": \"" << modeName(e.getMode()) << "\",\n";
+    out << "  \"cores\": " << e.coreCount() << ",\n";
+    out << "  \"balancing\": \"" << coreBalancingName(e.balancing()) << "\",\n";
+    out << "  \"cycles\": " << e.currentCycle() + 1 << ",\n";
+    out << "  \"finished\": " << (e.isFinished() ? "true" : "false") << ",\n";
+
+    out << "  \"metrics\": {"
+        << "\"completed\": "      << m.completed
+        << ", \"busyCycles\": "   << m.busyCycles
+        << ", \"idleCycles\": "   << m.idleCycles
+        << ", \"avgWaiting\": "   << m.avgWaiting()
+        << ", \"maxWaiting\": "   << m.maxWaiting
+        << ", \"avgLockWait\": "  << m.avgLockWait()
+        << ", \"maxLockWait\": "  << m.maxLockWait
+        << ", \"avgReadyWait\": " << m.avgReadyWait()
+        << ", \"avgTurnaround\": "<< m.avgTurnaround()
+        << ", \"maxTurnaround\": "<< m.maxTurnaround
+        << ", \"avgResponse\": "  << m.avgResponse()
+        << ", \"maxResponse\": "  << m.maxResponse
+        << ", \"throughput\": "   << m.throughput()
+        << ", \"utilization\": "  << m.utilization()
+        << ", \"migrations\": "   << m.migrations
+        << ", \"loadImbalance\": "<< m.loadImbalance()
+        << "},\n";
+
+    out << "  \"coreMetrics\": [";
+    for (int c = 0; c < m.cpuCount(); ++c) {
+        const CoreMetrics& cm = m.cores[c];
+        out << (c ? ",\n    " : "\n    ")
+            << "{\"core\": " << c
+            << ", \"busyCycles\": "  << cm.busyCycles
+            << ", \"idleCycles\": "  << cm.idleCycles
+            << ", \"utilization\": " << cm.utilization() << "}";
+    }
+    out << "\n  ],\n";
+
+    out << "  \"processes\": [";
+    for (size_t i = 0; i < procs.size(); ++i) {
+        const auto& p  = procs[i];
+        const auto& pm = e.processMetrics()[i];
+        out << (i ? ",\n    " : "\n    ")
+            << "{\"pid\": " << jsonStr(p.pid)
+            << ", \"burst\": "      << p.burst
+            << ", \"arrival\": "    << p.arrival
+            << ", \"priority\": "   << p.priority
+            << ", \"firstRun\": "   << pm.firstRun
+            << ", \"completion\": " << pm.completion
+            << ", \"waiting\": "    << pm.waiting
+            << ", \"lockWait\": "   << pm.lockWait
+            << ", \"readyWait\": "  << pm.readyWait
+            << ", \"turnaround\": " << pm.turnaround
+            << ", \"response\": "   << pm.response << "}";
+    }
+    out << "\n  ],\n";
+
+    out << "  \"schedule\": [";
+    bool first = true;
+    for (int c = 0; c < e.coreCount(); ++c) {
+        for (const auto& seg : e.getExecutionHistory(c).segments()) {
+            out << (first ? "\n    " : ",\n    ");
+            first = false;
+            out << "{\"core\": " << c << ", \"pid\": "
+                << (seg.procIdx < 0 ? std::string("null") : jsonStr(procs[seg.procIdx].pid))
+                << ", \"start\": " << seg.start << ", \"length\": " << seg.length << "}";
+        }
+    }
+    out << "\n  ],\n";
+
+    // sólo si la carga declara alguno
+    const std::vector<int> rw = rwLockIds(e);
+    if (!rw.empty()) {
+        out << "  \"rwLocks\": [";
+        for (size_t i = 0; i < rw.size(); ++i) {
+            const RwLock& l = e.getRwLock(rw[i]);
+            out << (i ? ",\n    " : "\n    ")
+                << "{\"resource\": " << jsonStr(e.resourceName(rw[i]))
+                << ", \"policy\": \"" << rwPolicyName(l.policy) << '"'
+                << ", \"maxReaders\": "    << l.maxReaders
+                << ", \"avgReaders\": "    << l.avgReaders(e.currentCycle())
+                << ", \"writes\": "        << l.writes
+                << ", \"avgWriterWait\": " << l.avgWriterWait()
+                << ", \"maxWriterWait\": " << l.maxWriterWait << "}";
+        }
+        out << "\n  ],\n";
+    }
+
+    out << "  \"syncLog\": [";
+    first = true;
+    for (const auto& ev : e.getSyncLog()) {
+        out << (first ? "\n    " : ",\n    ");
+        first = false;
+        out << "{\"cycle\": " << ev.cycle
+            << ", \"pid\": " << jsonStr(procs[ev.pidIdx].pid)
+            << ", \"resource\": " << jsonStr(e.resourceName(ev.res))
+            << ", \"action\": \"" << syncActionName(ev.action)
+            << "\", \"result\": \"" << syncResultName(ev.result) << "\"}";
+    }
+    out << "\n  ]\n}\n";
+}
+
+// CSV por secciones: cada tabla va precedida de "# <sección>" y su cabecera
+static void writeCsv(std::ostream& out, const SimulationEngine& e) {
+    const Metrics& m = e.metrics();
+    const auto& procs = e.procs();
+
+    out << "# metrics\n"
+        << "algorithm,quantum,mode,cores,balancing,cycles,completed,busy_cycles,idle_cycles,"
+           "avg_waiting,max_waiting,avg_turnaround,max_turnaround,"
+           "avg_response,max_response,throughput,utilization,migrations,load_imbalance,"
+           "avg_lock_wait,max_lock_wait,avg_ready_wait\n"
+        << e.policyName() << ',' << e.rrQuantum_ << ','
+        << modeName(e.getMode()) << ',' << e.coreCount() << ','
+        << coreBalancingName(e.balancing()) << ',' << e.currentCycle() + 1 << ','
+        << m.completed << ',' << m.busyCycles << ',' << m.idleCycles << ','
+        << m.avgWaiting() << ',' << m.maxWaiting << ','
+        << m.avgTurnaround() << ',' << m.maxTurnaround << ','
+        << m.avgResponse() << ',' << m.maxResponse << ','
+        << m.throughput() << ',' << m.utilization() << ','
+        << m.migrations << ',' << m.loadImbalance() << ','
+        << m.avgLockWait() << ',' << m.maxLockWait << ',' << m.avgReadyWait() << "\n\n";
+
+    out << "# cores\n" << "core,busy_cycles,idle_cycles,utilization\n";
+    for (int c = 0; c < m.cpuCount(); ++c) {
+        const CoreMetrics& cm = m.cores[c];
+        out << c << ',' << cm.busyCycles << ',' << cm.idleCycles << ','
+            << cm.utilization() << '\n';
+    }
+    out << '\n';
+
+    out << "# processes\n"
+        << "pid,burst,arrival,priority,first_run,completion,waiting,turnaround,response,"
+           "lock_wait,ready_wait\n";
+    for (size_t i = 0; i < procs.size(); ++i) {
+        const auto& p  = procs[i];
+        const auto& pm = e.processMetrics()[i];
+        out << csvStr(p.pid) << ',' << p.burst << ',' << p.arrival << ',' << p.priority << ','
+            << pm.firstRun << ',' << pm.completion << ',' << pm.waiting << ','
+            << pm.turnaround << ',' << pm.response << ','
+            << pm.lockWait << ',' << pm.readyWait << '\n';
+    }
+
+    out << "\n# schedule\n" << "core,pid,start,length\n";
+    for (int c = 0; c < e.coreCount(); ++c) {
+        for (const auto& seg : e.getExecutionHistory(c).segments()) {
+            out << c << ','
+                << (seg.procIdx < 0 ? std::string("idle") : csvStr(procs[seg.procIdx].pid))
+                << ',' << seg.start << ',' << seg.length << '\n';
+        }
+    }
+
+    const std::vector<int> rw = rwLockIds(e);
+    if (!rw.empty()) {
+        out << "\n# rw_locks\n"
+            << "resource,policy,max_readers,avg_readers,writes,avg_writer_wait,max_writer_wait\n";
+        for (int r : rw) {
+            const RwLock& l = e.getRwLock(r);
+            out << csvStr(e.resourceName(r)) << ',' << rwPolicyName(l.policy) << ','
+                << l.maxReaders << ',' << l.avgReaders(e.currentCycle()) << ','
+                << l.writes << ',' << l.avgWriterWait() << ',' << l.maxWriterWait << '\n';
+        }
+    }
+
+    out << "\n# sync_log\n" << "cycle,pid,resource,action,result\n";
+    for (const auto& ev : e.getSyncLog()) {
+        out << ev.cycle << ',' << csvStr(procs[ev.pidIdx].pid) << ','
+            << csvStr(e.resourceName(ev.res)) << ',' << syncActionName(ev.action) << ','
+            << syncResultName(ev.result) << '\n';
+    }
+}
+
+void writeReport(std::ostream& out, const SimulationEngine& engine, ReportFormat format) {
+    if (format == ReportFormat::JSON) writeJson(out, engine);
+    else                              writeCsv(out, engine);
+}
+
+void writeSweepReport(std::ostream& out, const SweepGrid& grid,
+                      const std::vector<SweepResult>& results, ReportFormat format) {
+    if (format == ReportFormat::JSON) {
+        out << "[";
+        for (size_t i = 0; i < results.size(); ++i) {
+            const SweepResult& r = results[i];
+            const Metrics& m = r.metrics;
+            out << (i ? ",\n  " : "\n  ")
+                << "{\"workload\": " << jsonStr(grid.workloads[r.point.workload].name)
+                << ", \"algorithm\": \"" << schedulingAlgoName(r.point.algo) << '"'
+                << ", \"quantum\": "       << r.point.quantum
+                << ", \"cycles\": "        << m.elapsed()
+                << ", \"avgWaiting\": "    << m.avgWaiting()
+                << ", \"avgLockWait\": "   << m.avgLockWait()
+                << ", \"avgReadyWait\": "  << m.avgReadyWait()
+                << ", \"avgTurnaround\": " << m.avgTurnaround()
+                << ", \"avgResponse\": "   << m.avgResponse()
+                << ", \"throughput\": "    << m.throughput()
+                << ", \"utilization\": "   << m.utilization() << "}";
+        }
+        out << "\n]\n";
+        return;
+    }
+
+    out << "workload,algorithm,quantum,cycles,avg_waiting,avg_lock_wait,avg_ready_wait,"
+           "avg_turnaround,avg_response,throughput,utilization\n";
+    for (const SweepResult& r : results) {
+        const Metrics& m = r.metrics;
+        out << csvStr(grid.workloads[r.point.workload].name) << ','
+            << schedulingAlgoName(r.point.algo) << ',' << r.point.quantum << ','
+            << m.elapsed() << ',' << m.avgWaiting() << ',' << m.avgLockWait() << ','
+            << m.avgReadyWait() << ',' << m.avgTurnaround() << ','
+            << m.avgResponse() << ',' << m.throughput() << ',' << m.utilization() << '\n';
+    }
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <ostream>
+#include "simulation/SimulationEngine.h"
+#include "simulation/ParameterSweep.h"
+
+enum class ReportFormat { JSON, CSV };
+
+// Vuelca el resultado de una simulación en formato legible por máquina:
+// métricas, tiempos por proceso, el calendario (tramos del historial), las
+// métricas de los RW locks (si hay) y el log de sincronización.
+void writeReport(std::ostream& out, const SimulationEngine& engine, ReportFormat format);
+
+// Tabla de resultados de un barrido: una fila por punto de la rejilla
+void writeSweepReport(std::ostream& out, const SweepGrid& grid,
+                      const std::vector<SweepResult>& results, ReportFormat format);
@@ -14,10 +14,20 @@ int main(int argc, char** argv) {
     try {
         
         std::string data_dir = DATA_DIR;
-
-        auto processes = loadProcesses(data_dir + "/processes.txt");
-        auto resources = loadResources(data_dir + "/resources.txt");
-        auto actions   = loadActions(data_dir + "/actions.txt");
+        std::string procPath = data_dir + "/processes.txt";
+        std::string resPath  = data_dir + "/resources.txt";
+        std::string actPath  = data_dir + "/actions.txt";
+
+        // Rutas opcionales: <procesos> <recursos> <acciones>
+        if (argc == 4) {
+            procPath = argv[1];
+            resPath  = argv[2];
+            actPath  = argv[3];
+        }
+
+        auto processes = loadProcesses(procPath);
+        auto resources = loadResources(resPath);
+        auto actions   = loadActions(actPath);
 
         ImGuiLayer app (
 
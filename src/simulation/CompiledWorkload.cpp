@@ -0,0 +1,159 @@
+#include "CompiledWorkload.h"
+#include "io/BinaryWorkload.h"
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+
+std::shared_ptr<const CompiledWorkload>
+CompiledWorkload::compile(const std::vector<Process>&  procs,
+                          const std::vector<Resource>& res,
+                          const std::vector<Action>&   acts)
+{
+    auto w = std::make_shared<CompiledWorkload>();
+    // ya vienen armados: se guardan tal cual y procs() no vuelve a armarlos
+    std::call_once(w->procsOnce_, [&]{ w->procs_ = procs; });
+    for (const Process& p : procs) {
+        w->addPid(p.pid);
+        w->burst.push_back(p.burst);
+        w->arrival.push_back(p.arrival);
+        w->priority.push_back(p.priority);
+    }
+    w->compileResources(res);
+
+    // PIDs y nombres de recurso a índices densos (PID repetido → el primero;
+    // recurso repetido → el último)
+    std::unordered_map<std::string, int> procIds, resIds;
+    for (int i = 0; i < (int)procs.size(); ++i)
+        procIds.emplace(procs[i].pid, i);
+    for (int i = 0; i < (int)res.size(); ++i)
+        resIds[res[i].name] = i;
+
+    w->acts.reserve(acts.size());
+    for (auto &a : acts) {
+        auto p = procIds.find(a.pid);
+        auto r = resIds.find(a.res);
+        int rid;
+        if (r != resIds.end()) {
+            rid = r->second;
+        } else {
+            w->undeclaredRes.push_back(a.res);
+            rid = -(int)w->undeclaredRes.size();
+        }
+        w->acts.push_back({ a.cycle, p != procIds.end() ? p->second : -1, rid, a.kind });
+    }
+    // estable: a igual ciclo se respeta el orden del archivo
+    std::stable_sort(w->acts.begin(), w->acts.end(),
+        [](const SyncOp& a, const SyncOp& b){ return a.cycle < b.cycle; });
+
+    w->finish();
+    return w;
+}
+
+std::shared_ptr<const CompiledWorkload>
+CompiledWorkload::compile(const BinaryWorkload& bin)
+{
+    auto w = std::make_shared<CompiledWorkload>();
+    w->compileResources(bin.resources());
+
+    // Se copian las columnas tal cual, sin hashear nombres ni reordenar; los
+    // PIDs van a un solo bloque y procs() arma los Process sólo si se piden
+    const uint32_t np = bin.processCount();
+    w->burst.assign(bin.burst(), bin.burst() + np);
+    w->arrival.assign(bin.arrival(), bin.arrival() + np);
+    w->priority.assign(bin.priority(), bin.priority() + np);
+    w->pidEnd_.reserve(np);
+    for (uint32_t i = 0; i < np; ++i)
+        w->addPid(bin.pid(i));
+
+    const size_t n = bin.actionCount();
+    const int32_t* cyc  = bin.actionCycle();
+    const int32_t* proc = bin.actionProc();
+    const int32_t* res  = bin.actionRes();
+    const uint8_t* kind = bin.actionKind();
+    w->acts.resize(n);
+    for (size_t i = 0; i < n; ++i)
+        w->acts[i] = { cyc[i], proc[i] >= 0 ? proc[i] : -1, res[i], (SyncAction)kind[i] };
+
+    for (uint32_t k = 0; k < bin.undeclaredResCount(); ++k)
+        w->undeclaredRes.emplace_back(bin.undeclaredRes(k));
+
+    w->finish();
+    return w;
+}
+
+// Ids de recurso = posición en resources.txt (capacidad 1 → mutex)
+void CompiledWorkload::compileResources(const std::vector<Resource>& res) {
+    int slots[RESOURCE_KIND_COUNT] = {};
+    for (auto &r : res) {
+        ResourceKind kind = r.rwLock       ? ResourceKind::RWLOCK
+                          : r.count == 1 ? ResourceKind::MUTEX
+                          :                ResourceKind::SEMAPHORE;
+        resources.names.push_back(r.name);
+        resources.kinds.push_back(kind);
+        resources.slots.push_back(slots[(int)kind]++);
+        resources.capacity.push_back(r.count);
+        resources.rwPolicy.push_back(r.rwPolicy);
+    }
+}
+
+void CompiledWorkload::addPid(std::string_view pid) {
+    pidChars_.append(pid);
+    pidEnd_.push_back((uint32_t)pidChars_.size());
+}
+
+const std::vector<Process>& CompiledWorkload::procs() const {
+    std::call_once(procsOnce_, [this]{
+        procs_.resize(processCount());
+        for (size_t i = 0; i < procs_.size(); ++i) {
+            procs_[i].pid.assign(pid((int)i));
+            procs_[i].burst    = burst[i];
+            procs_[i].arrival  = arrival[i];
+            procs_[i].priority = priority[i];
+        }
+    });
+    return procs_;
+}
+
+// Buckets de acciones por ciclo y por proceso e índice de llegadas
+void CompiledWorkload::finish() {
+    for (int i = 0; i < (int)acts.size(); ++i) {
+        if (buckets.empty() || buckets.back().cycle != acts[i].cycle)
+            buckets.push_back({ acts[i].cycle, i, i });
+        buckets.back().end = i + 1;
+    }
+    if (!buckets.empty())
+        maxSyncCycle = std::max(0, buckets.back().cycle);
+
+    // conteo por proceso y luego reparto: queda estable dentro de cada uno
+    procActStart.assign(processCount() + 1, 0);
+    for (const SyncOp& op : acts)
+        if (op.proc >= 0) procActStart[op.proc + 1]++;
+    for (size_t i = 0; i < processCount(); ++i)
+        procActStart[i + 1] += procActStart[i];
+    procActs.resize(procActStart.back());
+    std::vector<int> fill(procActStart.begin(), procActStart.end() - 1);
+    procActRank.assign(acts.size(), -1);
+    for (int a = 0; a < (int)acts.size(); ++a) {
+        const int p = acts[a].proc;
+        if (p < 0) continue;
+        procActRank[a] = fill[p] - procActStart[p];
+        procActs[fill[p]++] = a;
+    }
+
+    // lo mismo por semáforo, sólo con los SIGNAL
+    resSignalStart.assign(resources.kinds.size() + 1, 0);
+    for (const SyncOp& op : acts)
+        if (isSemSignal(op)) resSignalStart[op.res + 1]++;
+    for (size_t r = 0; r < resources.kinds.size(); ++r)
+        resSignalStart[r + 1] += resSignalStart[r];
+    resSignals.resize(resSignalStart.back());
+    fill.assign(resSignalStart.begin(), resSignalStart.end() - 1);
+    for (int a = 0; a < (int)acts.size(); ++a)
+        if (isSemSignal(acts[a])) resSignals[fill[acts[a].res]++] = a;
+
+    // a igual llegada, por índice; handleArrivals avanza un cursor sobre esto
+    arrivalOrder.resize(processCount());
+    std::iota(arrivalOrder.begin(), arrivalOrder.end(), 0);
+    std::stable_sort(arrivalOrder.begin(), arrivalOrder.end(),
+        [&](int a, int b){ return arrival[a] < arrival[b]; });
+}
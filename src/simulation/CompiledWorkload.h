@@ -0,0 +1,86 @@
+#pragma once
+
+#include "Process.h"
+#include "Resource.h"
+#include "Action.h"
+#include "SyncPrimitives/SyncPrimitives.h"
+#include <algorithm>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class BinaryWorkload;
+
+// Entradas de una simulación ya resueltas a índices. Es inmutable una vez
+// compilada: todas las copias y forks de un SimulationEngine (y los hilos de
+// un barrido) comparten la misma instancia por shared_ptr.
+struct CompiledWorkload {
+    // Rango de acts con acciones en `cycle`
+    struct ActionBucket {
+        int cycle;
+        int begin, end;
+    };
+
+    // columnas de los campos que usa el planificador
+    std::vector<int32_t>      burst;
+    std::vector<int32_t>      arrival;
+    std::vector<int32_t>      priority;
+    ResourceTable             resources;
+    std::vector<SyncOp>       acts;           // ordenadas por ciclo (estable)
+    std::vector<ActionBucket> buckets;
+    // Modo UNIFIED: índices en acts agrupados por proceso (los de `i` en
+    // [procActStart[i], procActStart[i + 1]), por ciclo como en acts)
+    std::vector<int>          procActs;
+    std::vector<int>          procActStart;
+    std::vector<int>          procActRank;    // posición de acts[a] entre las de su proceso
+    bool isSemSignal(const SyncOp& op) const {
+        return op.type == SyncAction::SIGNAL && op.proc >= 0 && op.res >= 0 &&
+               resources.kinds[op.res] == ResourceKind::SEMAPHORE;
+    }
+    // SIGNAL sobre cada semáforo (los de `r` en [resSignalStart[r],
+    // resSignalStart[r + 1]), índices en acts en orden): quién puede todavía
+    // devolverlo, para no confundir una espera larga con un interbloqueo
+    std::vector<int>          resSignals;
+    std::vector<int>          resSignalStart;
+    std::vector<std::string>  undeclaredRes;  // nombres citados sin declarar
+    std::vector<int>          arrivalOrder;   // índices por llegada (estable)
+    int                       maxSyncCycle = 0;
+
+    size_t processCount() const { return burst.size(); }
+    // PID del proceso `i`, sin reservar memoria
+    std::string_view pid(int i) const {
+        const uint32_t begin = i > 0 ? pidEnd_[i - 1] : 0;
+        return std::string_view(pidChars_).substr(begin, pidEnd_[i] - begin);
+    }
+    // Procesos tal como se cargaron (para vistas y reportes). Desde una carga
+    // binaria se arman la primera vez que se piden; es seguro entre hilos.
+    const std::vector<Process>& procs() const;
+
+    static std::shared_ptr<const CompiledWorkload> compile(const std::vector<Process>&  procs,
+                                                           const std::vector<Resource>& res,
+                                                           const std::vector<Action>&   acts);
+    // Desde una carga binaria: las acciones ya vienen resueltas y ordenadas
+    static std::shared_ptr<const CompiledWorkload> compile(const BinaryWorkload& w);
+
+    // Modo UNIFIED: ciclos que debe haber ejecutado su proceso para que se
+    // dispare acts[a]. Lo que cae más allá de la ráfaga se dispara antes de
+    // su último ciclo, así nadie termina bloqueado.
+    int execOffset(int a) const {
+        const SyncOp& op = acts[a];
+        return std::max(0, std::min(op.cycle, burst[op.proc] - 1));
+    }
+
+private:
+    void compileResources(const std::vector<Resource>& res);
+    void addPid(std::string_view pid);
+    void finish();
+
+    // todos los PIDs seguidos; pidEnd_[i] es donde termina el de `i`
+    std::string                  pidChars_;
+    std::vector<uint32_t>        pidEnd_;
+    mutable std::once_flag       procsOnce_;
+    mutable std::vector<Process> procs_;
+};
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <vector>
+#include <algorithm>
+
+// Tramo de ejecución: `procIdx` ocupó la CPU durante `length` ciclos
+// consecutivos a partir de `start` (procIdx == -1 → CPU ociosa)
+struct ExecSegment {
+    int procIdx;
+    int start;
+    int length;
+
+    int end() const { return start + length; }
+    bool operator==(const ExecSegment& o) const {
+        return procIdx == o.procIdx && start == o.start && length == o.length;
+    }
+};
+
+// Historial de ejecución codificado por tramos (run-length). Los tramos son
+// contiguos y empiezan en el ciclo 0.
+class ExecutionHistory {
+public:
+    static constexpr int IDLE = -1;
+
+    void clear() { runs_.clear(); cycles_ = 0; }
+
+    // Registra `k` ciclos más de `procIdx`, extendiendo el último tramo si coincide
+    void append(int procIdx, int k = 1) {
+        if (k <= 0) return;
+        if (!runs_.empty() && runs_.back().procIdx == procIdx)
+            runs_.back().length += k;
+        else
+            runs_.push_back({ procIdx, cycles_, k });
+        cycles_ += k;
+    }
+
+    // Descarta todo lo registrado a partir del ciclo `cycles`
+    void truncate(int cycles) {
+        if (cycles >= cycles_) return;
+        if (cycles <= 0) { clear(); return; }
+        size_t s = segmentAt(cycles);
+        if (runs_[s].start < cycles) {
+            runs_[s].length = cycles - runs_[s].start;
+            s++;
+        }
+        runs_.erase(runs_.begin() + s, runs_.end());
+        cycles_ = cycles;
+    }
+
+    int  cycles() const { return cycles_; }
+    bool empty()  const { return cycles_ == 0; }
+
+    const std::vector<ExecSegment>& segments() const { return runs_; }
+
+    // Primer tramo que termina después de `cycle` (segments().size() si ninguno)
+    size_t segmentAt(int cycle) const {
+        auto it = std::upper_bound(runs_.begin(), runs_.end(), cycle,
+            [](int c, const ExecSegment& s){ return c < s.end(); });
+        return (size_t)(it - runs_.begin());
+    }
+
+    // Proceso que ocupó la CPU en `cycle` (IDLE si no existe ese ciclo)
+    int procAt(int cycle) const {
+        if (cycle < 0 || cycle >= cycles_) return IDLE;
+        return runs_[segmentAt(cycle)].procIdx;
+    }
+
+private:
+    std::vector<ExecSegment> runs_;
+    int cycles_ = 0;
+};
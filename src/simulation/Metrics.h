@@ -0,0 +1,92 @@
+#pragma once
+
+#include <algorithm>
+#include <vector>
+
+// Tiempos de un proceso (-1 mientras no se conocen)
+struct ProcessMetrics {
+    int firstRun   = -1;   // primer ciclo en CPU
+    int response   = -1;   // firstRun - arrival
+    int completion = -1;
+    int turnaround = -1;   // completion - arrival
+    int waiting    = -1;   // turnaround - burst
+    int lockWait   = -1;   // parte de waiting bloqueado en recursos
+    int readyWait  = -1;   // parte de waiting en colas de listos
+};
+
+// Ocupación de un núcleo
+struct CoreMetrics {
+    long long busyCycles = 0;
+    long long idleCycles = 0;
+
+    float utilization() const {
+        long long total = busyCycles + idleCycles;
+        return total ? (float)busyCycles / total : 0.0f;
+    }
+};
+
+// Métricas de calendarización mantenidas de forma incremental por el motor;
+// todas las consultas son O(1) salvo loadImbalance(), O(núcleos).
+// Con varios núcleos busyCycles/idleCycles suman ciclos-núcleo.
+struct Metrics {
+    int       completed   = 0;   // procesos terminados
+    int       responded   = 0;   // procesos que ya obtuvieron CPU
+    long long busyCycles  = 0;
+    long long idleCycles  = 0;
+    long long migrations  = 0;   // despachos en un núcleo distinto del anterior
+    std::vector<CoreMetrics> cores = std::vector<CoreMetrics>(1);
+
+    long long sumWaiting    = 0;
+    long long sumTurnaround = 0;
+    long long sumResponse   = 0;
+    int       maxWaiting    = 0;
+    int       maxTurnaround = 0;
+    int       maxResponse   = 0;
+    // waiting = lockWait + readyWait (lockWait es 0 salvo en modo UNIFIED)
+    long long sumLockWait   = 0;
+    long long sumReadyWait  = 0;
+    int       maxLockWait   = 0;
+
+    void onFirstRun(const ProcessMetrics& p) {
+        responded++;
+        sumResponse += p.response;
+        maxResponse  = std::max(maxResponse, p.response);
+    }
+
+    void onCompletion(const ProcessMetrics& p) {
+        completed++;
+        sumWaiting    += p.waiting;
+        sumTurnaround += p.turnaround;
+        maxWaiting     = std::max(maxWaiting, p.waiting);
+        maxTurnaround  = std::max(maxTurnaround, p.turnaround);
+        sumLockWait   += p.lockWait;
+        sumReadyWait  += p.readyWait;
+        maxLockWait    = std::max(maxLockWait, p.lockWait);
+    }
+
+    int       cpuCount() const { return (int)cores.size(); }
+    long long elapsed()  const { return (busyCycles + idleCycles) / cpuCount(); }
+
+    float avgWaiting()    const { return completed ? (float)sumWaiting    / completed : 0.0f; }
+    float avgTurnaround() const { return completed ? (float)sumTurnaround / completed : 0.0f; }
+    float avgResponse()   const { return responded ? (float)sumResponse   / responded : 0.0f; }
+    float avgLockWait()   const { return completed ? (float)sumLockWait   / completed : 0.0f; }
+    float avgReadyWait()  const { return completed ? (float)sumReadyWait  / completed : 0.0f; }
+
+    // procesos terminados por ciclo
+    float throughput()  const { return elapsed() ? (float)completed  / elapsed() : 0.0f; }
+    // fracción de ciclos-núcleo con la CPU ocupada
+    float utilization() const {
+        long long total = busyCycles + idleCycles;
+        return total ? (float)busyCycles / total : 0.0f;
+    }
+
+    // Desbalance de carga: ciclos ocupados del núcleo más cargado sobre la
+    // media, menos 1 (0 = reparto perfecto)
+    float loadImbalance() const {
+        if (busyCycles == 0) return 0.0f;
+        long long most = 0;
+        for (const CoreMetrics& c : cores) most = std::max(most, c.busyCycles);
+        return (float)most * cpuCount() / busyCycles - 1.0f;
+    }
+};
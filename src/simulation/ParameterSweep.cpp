@@ -0,0 +1,78 @@
+#include "ParameterSweep.h"
+#include "simulation/SimulationEngine.h"
+#include "common/WorkStealingPool.h"
+#include <memory>
+#include <stdexcept>
+
+std::vector<SweepPoint> expandSweepGrid(const SweepGrid& grid) {
+    if (grid.quantumMin < 1 || grid.quantumMax < grid.quantumMin)
+        throw std::invalid_argument("Rango de quantum inválido en el barrido");
+    if (grid.mode == SimMode::SYNCHRONIZATION)
+        throw std::invalid_argument("El barrido compara planificadores: modo scheduling o unified");
+    if (grid.cores < 1)
+        throw std::invalid_argument("Se necesita al menos un núcleo");
+
+    std::vector<SweepPoint> points;
+    for (int w = 0; w < (int)grid.workloads.size(); ++w) {
+        for (SchedulingAlgo algo : grid.algorithms) {
+            if (usesQuantum(algo)) {
+                for (int q = grid.quantumMin; q <= grid.quantumMax; ++q)
+                    points.push_back({ w, algo, q });
+            } else {
+                points.push_back({ w, algo, 0 });
+            }
+        }
+    }
+    return points;
+}
+
+std::vector<SweepResult> runSweep(const SweepGrid& grid, WorkStealingPool& pool) {
+    const std::vector<SweepPoint> points = expandSweepGrid(grid);
+    std::vector<SweepResult> results(points.size());
+
+    // Cada carga se compila una vez y la comparten todos los trabajadores
+    std::vector<std::shared_ptr<const CompiledWorkload>> compiled;
+    for (const SweepWorkload& wl : grid.workloads)
+        compiled.push_back(wl.compiled ? wl.compiled
+                                       : CompiledWorkload::compile(wl.processes, wl.resources,
+                                                                   wl.actions));
+
+    // Un motor por trabajador; se reconstruye sólo al cambiar de carga
+    struct alignas(64) WorkerState {   // una línea de caché por trabajador
+        std::unique_ptr<SimulationEngine> engine;
+        int workload = -1;
+    };
+    std::vector<WorkerState> workers(pool.size());
+
+    pool.parallelFor(points.size(), [&](size_t i, unsigned w) {
+        const SweepPoint& pt = points[i];
+        WorkerState& ws = workers[w];
+        const int quantum = pt.quantum > 0 ? pt.quantum : 1;
+
+        if (ws.workload != pt.workload) {
+            ws.engine = std::make_unique<SimulationEngine>(
+                compiled[pt.workload], pt.algo, quantum);
+            ws.engine->setMode(grid.mode);
+            ws.engine->setCores(grid.cores, grid.balancing);
+            ws.engine->mlfqBoostPeriod_ = grid.mlfqBoostPeriod;
+            ws.workload = pt.workload;
+        } else {
+            ws.engine->setAlgorithm(pt.algo);
+            ws.engine->rrQuantum_ = quantum;
+            ws.engine->reset();
+        }
+
+        SimulationEngine& engine = *ws.engine;
+        while (!engine.isFinished())
+            engine.advanceToNextEvent();
+
+        results[i] = { pt, engine.metrics() };
+    });
+
+    return results;
+}
+
+std::vector<SweepResult> runSweep(const SweepGrid& grid, unsigned threads) {
+    WorkStealingPool pool(threads);
+    return runSweep(grid, pool);
+}
@@ -0,0 +1,59 @@
+#pragma once
+
+#include "Process.h"
+#include "Resource.h"
+#include "Action.h"
+#include "simulation/Metrics.h"
+#include "common/SimMode.h"
+#include "simulation/SimulationEngine.h"
+#include <memory>
+#include <string>
+#include <vector>
+
+class WorkStealingPool;
+
+// Una carga de trabajo completa (las mismas entradas que SimulationEngine).
+// Si `compiled` viene armada (p. ej. desde una carga binaria) se usa tal cual
+// y los vectores pueden quedar vacíos.
+struct SweepWorkload {
+    std::string           name;
+    std::vector<Process>  processes;
+    std::vector<Resource> resources;
+    std::vector<Action>   actions;
+    std::shared_ptr<const CompiledWorkload> compiled;
+};
+
+// Rejilla de barrido: algoritmos × rango de quantum × cargas. El quantum sólo
+// multiplica los puntos de RR, CFS y MLFQ; el resto se simula una vez por carga.
+// En UNIFIED las acciones bloquean procesos dentro de cada algoritmo.
+struct SweepGrid {
+    std::vector<SchedulingAlgo> algorithms;
+    int quantumMin = 1;
+    int quantumMax = 1;
+    SimMode mode   = SimMode::SCHEDULING;   // SCHEDULING o UNIFIED
+    int cores      = 1;                     // núcleos y reparto de cada punto
+    CoreBalancing balancing = CoreBalancing::GLOBAL;
+    int mlfqBoostPeriod = 100;              // ciclos entre boosts de MLFQ, 0 = nunca
+    std::vector<SweepWorkload> workloads;
+};
+
+struct SweepPoint {
+    int            workload;   // índice en SweepGrid::workloads
+    SchedulingAlgo algo;
+    int            quantum;    // 0 si el algoritmo no usa quantum
+};
+
+struct SweepResult {
+    SweepPoint point;
+    Metrics    metrics;
+};
+
+// Puntos de la rejilla, agrupados por carga (así un trabajador reutiliza el
+// motor entre puntos consecutivos)
+std::vector<SweepPoint> expandSweepGrid(const SweepGrid& grid);
+
+// Simula cada punto hasta el final en el modo de la rejilla. Cada trabajador
+// tiene su propio SimulationEngine; las cargas sólo se leen. El resultado
+// está en el orden de expandSweepGrid, independiente del reparto entre hilos.
+std::vector<SweepResult> runSweep(const SweepGrid& grid, WorkStealingPool& pool);
+std::vector<SweepResult> runSweep(const SweepGrid& grid, unsigned threads = 0);
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "Process.h"
+#include <cstdint>
+#include <vector>
+
+// Estado vivo de los procesos como estructura de arreglos: cada campo es una
+// columna contigua indexada por proceso, así los recorridos del planificador
+// sólo tocan las líneas de caché del campo que usan.
+struct ProcessTable {
+    std::vector<int32_t>   remaining;
+    std::vector<int32_t>   completion;        // -1 mientras no termina
+    std::vector<ProcState> state;
+    std::vector<uint8_t>   justGrantedMutex;
+    std::vector<uint8_t>   queued;            // está en alguna cola de listos
+    std::vector<int32_t>   lastCore;          // último núcleo en que corrió (-1 = ninguno)
+    std::vector<int64_t>   vruntime;          // CFS: tiempo virtual ponderado por nice
+    std::vector<uint8_t>   level;             // MLFQ: nivel actual (0 = más prioritario)
+    std::vector<int32_t>   levelUsed;         // MLFQ: ciclos consumidos en ese nivel
+    std::vector<int32_t>   levelEpoch;        // MLFQ: boost en que se fijó el nivel
+    std::vector<int32_t>   lockWait;          // ciclos bloqueado esperando recursos
+    std::vector<int32_t>   blockedSince;      // ciclo en que se bloqueó (-1 = no lo está)
+    std::vector<int32_t>   actsDone;          // UNIFIED: acciones propias ya disparadas
+
+    size_t size() const { return remaining.size(); }
+
+    // Todos listos, con remaining = burst
+    void reset(const std::vector<int32_t>& burst) {
+        remaining = burst;
+        completion.assign(burst.size(), -1);
+        state.assign(burst.size(), ProcState::READY);
+        justGrantedMutex.assign(burst.size(), 0);
+        queued.assign(burst.size(), 0);
+        lastCore.assign(burst.size(), -1);
+        vruntime.assign(burst.size(), 0);
+        level.assign(burst.size(), 0);
+        levelUsed.assign(burst.size(), 0);
+        levelEpoch.assign(burst.size(), 0);
+        lockWait.assign(burst.size(), 0);
+        blockedSince.assign(burst.size(), -1);
+        actsDone.assign(burst.size(), 0);
+    }
+};
@@ -0,0 +1,132 @@
+#include "ReadyQueue.h"
+#include <stdexcept>
+
+void ReadyQueue::reset(Order order, int nProcs, bool indexed) {
+    order_   = order;
+    head_    = 0;
+    nextSeq_ = nProcs;
+    indexed_ = indexed;
+    items_.clear();
+    if (indexed) {
+        items_.reserve(nProcs);
+        pos_.assign(nProcs, -1);
+    } else {
+        pos_.clear();
+    }
+}
+
+void ReadyQueue::requireIndex() const {
+    if (!indexed_)
+        throw std::logic_error("ReadyQueue: operación sólo válida en colas indexadas");
+}
+
+void ReadyQueue::place(size_t pos, const Entry& e) {
+    items_[pos] = e;
+    if (indexed_) pos_[e.idx] = (int)pos;
+}
+
+void ReadyQueue::siftUp(size_t pos) {
+    Entry e = items_[pos];
+    while (pos > 0) {
+        size_t parent = (pos - 1) / 2;
+        if (!less(e, items_[parent])) break;
+        place(pos, items_[parent]);
+        pos = parent;
+    }
+    place(pos, e);
+}
+
+void ReadyQueue::siftDown(size_t pos) {
+    Entry  e = items_[pos];
+    size_t n = items_.size();
+    while (true) {
+        size_t child = 2 * pos + 1;
+        if (child >= n) break;
+        if (child + 1 < n && less(items_[child + 1], items_[child])) child++;
+        if (!less(items_[child], e)) break;
+        place(pos, items_[child]);
+        pos = child;
+    }
+    place(pos, e);
+}
+
+// Descarta la parte ya consumida de la cola FIFO
+void ReadyQueue::compact() {
+    if (head_ < 1024 || head_ * 2 < items_.size()) return;
+    items_.erase(items_.begin(), items_.begin() + head_);
+    head_ = 0;
+    if (indexed_)
+        for (size_t i = 0; i < items_.size(); ++i) pos_[items_[i].idx] = (int)i;
+}
+
+void ReadyQueue::push(int idx, long long key, long long seq) {
+    if (indexed_ && pos_[idx] >= 0)
+        throw std::logic_error("ReadyQueue: proceso encolado dos veces");
+
+    items_.push_back({ idx, key, seq >= 0 ? seq : nextSeq_++ });
+    if (indexed_) pos_[idx] = (int)items_.size() - 1;
+    if (order_ == Order::MIN_KEY) siftUp(items_.size() - 1);
+}
+
+int ReadyQueue::pop() {
+    int idx = top();
+    if (indexed_) pos_[idx] = -1;
+
+    if (order_ == Order::FIFO) {
+        head_++;
+        compact();
+        return idx;
+    }
+
+    Entry last = items_.back();
+    items_.pop_back();
+    if (!items_.empty()) {
+        place(0, last);
+        siftDown(0);
+    }
+    return idx;
+}
+
+bool ReadyQueue::remove(int idx) {
+    requireIndex();
+    int pos = pos_[idx];
+    if (pos < 0) return false;
+    pos_[idx] = -1;
+
+    if (order_ == Order::FIFO) {
+        items_.erase(items_.begin() + pos);
+        for (size_t i = pos; i < items_.size(); ++i) pos_[items_[i].idx] = (int)i;
+        return true;
+    }
+
+    Entry last = items_.back();
+    items_.pop_back();
+    if ((size_t)pos < items_.size()) {
+        place(pos, last);
+        siftUp(pos);
+        siftDown(pos_[last.idx]);
+    }
+    return true;
+}
+
+void ReadyQueue::updateKey(int idx, long long key) {
+    requireIndex();
+    int pos = pos_[idx];
+    if (pos < 0) return;
+    long long old = items_[pos].key;
+    items_[pos].key = key;
+    if (order_ == Order::FIFO) return;
+
+    if (key < old) siftUp(pos);
+    else           siftDown(pos);
+}
+
+bool ReadyQueue::contains(int idx) const {
+    requireIndex();
+    return pos_[idx] >= 0;
+}
+
+long long ReadyQueue::keyOf(int idx) const {
+    requireIndex();
+    return pos_[idx] >= 0 ? items_[pos_[idx]].key : 0;
+}
@@ -0,0 +1,75 @@
+#pragma once
+
+#include <vector>
+#include <cstddef>
+
+// Cola de listos de la simulación.
+//  - Order::FIFO    → cola por orden de llegada (FIFO, RR)
+//  - Order::MIN_KEY → min-heap por clave (SJF, SRT, PRIORITY, CFS, MLFQ);
+//    a igual clave sale primero el que se encoló antes.
+// La clave y el orden de encolado viajan en cada entrada. Si se crea
+// indexada guarda además la posición de cada proceso, así que updateKey
+// (decrease-key) y remove por índice cuestan O(log n); sin índice no
+// reserva nada por proceso (el motor usa una cola por núcleo).
+class ReadyQueue {
+    struct Entry {
+        int       idx;
+        long long key;
+        long long seq;   // orden de encolado (desempate)
+    };
+
+public:
+    enum class Order { FIFO, MIN_KEY };
+
+    void reset(Order order, int nProcs, bool indexed = true);
+
+    // seq < 0 → se usa el orden de encolado; los automáticos empiezan en
+    // nProcs para que un seq explícito = índice quede antes que ellos
+    void push(int idx, long long key = 0, long long seq = -1);
+    int  pop();
+    int  top()    const { return items_[head_].idx; }
+    long long topKey() const { return items_[head_].key; }
+
+    // Sólo en colas indexadas
+    bool remove(int idx);
+    void updateKey(int idx, long long key);
+    bool contains(int idx) const;
+    long long keyOf(int idx) const;
+
+    Order  order() const { return order_; }
+    bool   empty() const { return size() == 0; }
+    size_t size()  const { return items_.size() - head_; }
+
+    // Vista de sólo lectura (en modo MIN_KEY el orden es el interno del heap)
+    class const_iterator {
+    public:
+        explicit const_iterator(const Entry* p) : p_(p) {}
+        int operator*() const { return p_->idx; }
+        const_iterator& operator++() { ++p_; return *this; }
+        bool operator!=(const const_iterator& o) const { return p_ != o.p_; }
+        bool operator==(const const_iterator& o) const { return p_ == o.p_; }
+    private:
+        const Entry* p_;
+    };
+    const_iterator begin() const { return const_iterator(items_.data() + head_); }
+    const_iterator end()   const { return const_iterator(items_.data() + items_.size()); }
+    int operator[](size_t i) const { return items_[head_ + i].idx; }
+
+private:
+    static bool less(const Entry& a, const Entry& b) {
+        if (a.key != b.key) return a.key < b.key;
+        return a.seq < b.seq;
+    }
+    void place(size_t pos, const Entry& e);
+    void siftUp(size_t pos);
+    void siftDown(size_t pos);
+    void compact();
+    void requireIndex() const;
+
+    Order order_ = Order::FIFO;
+    std::vector<Entry> items_;   // FIFO: cola desde head_; MIN_KEY: arreglo del heap
+    size_t             head_ = 0;
+    bool               indexed_ = true;
+    std::vector<int>   pos_;     // posición en items_ de cada proceso (-1 = no está)
+    long long          nextSeq_ = 0;
+};
@@ -0,0 +1,223 @@
+#pragma once
+
+#include "simulation/CompiledWorkload.h"
+#include "simulation/ProcessTable.h"
+#include "simulation/ReadyQueue.h"
+#include <algorithm>
+#include <climits>
+#include <cstdint>
+#include <vector>
+
+// Políticas de calendarización como clases con interfaz uniforme. El motor
+// instancia su ciclo interno (tick, avance por eventos) una vez por política,
+// así que el tipo de cola, la regla de expropiación y los contadores quedan
+// fijos en compilación; la elección en tiempo de ejecución ocurre una sola
+// vez (SimulationEngine::setAlgorithm o setPolicy<P>()).
+//
+// Una política hereda de PolicyBase<P> y define al menos:
+//   name, order (FIFO o MIN_KEY) y key(ctx, idx), la clave en la cola.
+// El resto de los ganchos tienen un valor por defecto que puede ocultarse.
+
+// Estado que las políticas leen o actualizan
+struct SchedContext {
+    const CompiledWorkload& wl;
+    ProcessTable&           live;
+    std::vector<int>&       slice;        // ciclos en CPU desde el último despacho, por núcleo
+    long long&              minVruntime;  // CFS
+    int&                    boostEpoch;   // MLFQ
+    int                     quantum;
+    int                     boostPeriod;
+    int                     cycle;
+};
+
+enum class Preemption {
+    NONE,     // sólo se elige en núcleos ociosos
+    STRICT,   // el tope de la cola expropia si su clave es menor
+    ON_TIE    // ... o igual (a igual clave gana el que espera)
+};
+
+template <class P>
+struct PolicyBase {
+    static constexpr bool       tieByIndex = false;   // empates de llegada por índice de proceso
+    static constexpr Preemption preemption = Preemption::NONE;
+
+    // Al entrar a una cola (llegada o despertar)
+    static void admit(SchedContext&, int) {}
+    // Al ponerse a correr en un núcleo
+    static void onDispatch(SchedContext&, int /*core*/, int /*idx*/) {}
+    // `k` ciclos ejecutados
+    static void onRun(SchedContext&, int /*idx*/, int /*k*/) {}
+    // Al empezar cada ciclo de calendarización
+    static void beginTick(SchedContext&) {}
+    // true → el proceso en ejecución vuelve a la cola (fin de quantum)
+    static bool expire(SchedContext&, int /*core*/, int /*idx*/) { return false; }
+    // El proceso en ejecución puede ser expropiado en este ciclo
+    static bool preemptible(const SchedContext&, int /*core*/, int /*idx*/) { return true; }
+
+    // Claves comparables entre el proceso en ejecución y el tope de la cola
+    static long long runningKey(const SchedContext& c, int idx) { return P::key(c, idx); }
+    static long long effectiveKey(const SchedContext&, long long key) { return key; }
+
+    // Ciclos que pueden pasar sin que el proceso de `core` expire o ceda
+    static int quietLimit(const SchedContext&, int /*core*/, int /*idx*/, const ReadyQueue&) {
+        return INT_MAX;
+    }
+    // Ciclos hasta el próximo evento propio de la política
+    static int nextEvent(const SchedContext&) { return INT_MAX; }
+};
+
+struct FifoPolicy : PolicyBase<FifoPolicy> {
+    static constexpr const char*       name  = "FIFO";
+    static constexpr ReadyQueue::Order order = ReadyQueue::Order::FIFO;
+    static long long key(const SchedContext&, int) { return 0; }
+};
+
+// Shortest Job First: el tope del heap es el de menor burst
+struct SjfPolicy : PolicyBase<SjfPolicy> {
+    static constexpr const char*       name       = "SJF";
+    static constexpr ReadyQueue::Order order      = ReadyQueue::Order::MIN_KEY;
+    static constexpr bool              tieByIndex = true;
+    static long long key(const SchedContext& c, int idx) { return c.wl.burst[idx]; }
+};
+
+// Shortest Remaining Time: a igual remaining gana el que espera en la cola
+struct SrtPolicy : PolicyBase<SrtPolicy> {
+    static constexpr const char*       name       = "SRT";
+    static constexpr ReadyQueue::Order order      = ReadyQueue::Order::MIN_KEY;
+    static constexpr Preemption        preemption = Preemption::ON_TIE;
+    static long long key(const SchedContext& c, int idx) { return c.live.remaining[idx]; }
+};
+
+struct RoundRobinPolicy : PolicyBase<RoundRobinPolicy> {
+    static constexpr const char*       name  = "RR";
+    static constexpr ReadyQueue::Order order = ReadyQueue::Order::FIFO;
+    static long long key(const SchedContext&, int) { return 0; }
+
+    static bool expire(SchedContext& c, int core, int) { return c.slice[core] >= c.quantum; }
+    static int  quietLimit(const SchedContext& c, int core, int, const ReadyQueue&) {
+        return c.quantum - c.slice[core];
+    }
+};
+
+// Prioridad expropiativa: menor número, más prioritario
+struct PriorityPolicy : PolicyBase<PriorityPolicy> {
+    static constexpr const char*       name       = "PRIORITY";
+    static constexpr ReadyQueue::Order order      = ReadyQueue::Order::MIN_KEY;
+    static constexpr bool              tieByIndex = true;
+    static constexpr Preemption        preemption = Preemption::STRICT;
+    static long long key(const SchedContext& c, int idx) { return c.wl.priority[idx]; }
+};
+
+// Pesos de CFS por nice (-20..19), los de Linux: cada nivel de nice cambia
+// la parte de CPU en ~10%
+inline constexpr int CFS_WEIGHTS[40] = {
+    88761, 71755, 56483, 46273, 36291,
+    29154, 23254, 18705, 14949, 11916,
+     9548,  7620,  6100,  4904,  3906,
+     3121,  2501,  1991,  1586,  1277,
+     1024,   820,   655,   526,   423,
+      335,   272,   215,   172,   137,
+      110,    87,    70,    56,    45,
+       36,    29,    23,    18,    15,
+};
+
+// Completely Fair Scheduler: corre el de menor vruntime. El actual cede
+// después de `quantum` ciclos (granularidad mínima) si quedó por delante del
+// primero de la cola. Quien entra a una cola arranca desde el piso de
+// vruntime para no acaparar la CPU.
+struct CfsPolicy : PolicyBase<CfsPolicy> {
+    static constexpr const char*       name       = "CFS";
+    static constexpr ReadyQueue::Order order      = ReadyQueue::Order::MIN_KEY;
+    static constexpr Preemption        preemption = Preemption::STRICT;
+
+    // vruntime que suma un ciclo de CPU; el nice es la prioridad del
+    // proceso. Un ciclo con nice 0 vale 1024.
+    static long long delta(const SchedContext& c, int idx) {
+        int nice = std::clamp<int>(c.wl.priority[idx], -20, 19);
+        return (1024LL * 1024) / CFS_WEIGHTS[nice + 20];
+    }
+
+    static long long key(const SchedContext& c, int idx) { return c.live.vruntime[idx]; }
+
+    static void admit(SchedContext& c, int idx) {
+        c.live.vruntime[idx] = std::max<long long>(c.live.vruntime[idx], c.minVruntime);
+    }
+    static void onDispatch(SchedContext& c, int, int idx) {
+        c.minVruntime = std::max<long long>(c.minVruntime, c.live.vruntime[idx]);
+    }
+    static void onRun(SchedContext& c, int idx, int k) {
+        c.live.vruntime[idx] += k * delta(c, idx);
+    }
+    static bool preemptible(const SchedContext& c, int core, int) {
+        return c.slice[core] >= c.quantum;
+    }
+    // cede cuando cumplió la granularidad y su vruntime pasó al del tope
+    static int quietLimit(const SchedContext& c, int core, int idx, const ReadyQueue& queue) {
+        if (queue.empty()) return INT_MAX;
+        long long vr = c.live.vruntime[idx], top = queue.topKey();
+        long long behind = top < vr ? 0 : (top - vr) / delta(c, idx) + 1;
+        long long wait   = std::max<long long>(c.quantum - c.slice[core], behind);
+        return (int)std::min<long long>(wait, INT_MAX);
+    }
+};
+
+// Multi-level feedback queue con LEVELS niveles y quantum q, 2q, 4q... La
+// cola ordena por (boost, nivel) y dentro de eso por llegada. Agotar el
+// quantum del nivel baja uno; un nivel más alto en la cola expropia
+// (conservando lo consumido). Cada boostPeriod ciclos todos vuelven al
+// nivel 0: sólo avanza boostEpoch, y un nivel fijado en un boost anterior
+// vale 0 (lo encolado antes queda delante, en el orden que tenía).
+struct MlfqPolicy : PolicyBase<MlfqPolicy> {
+    static constexpr const char*       name       = "MLFQ";
+    static constexpr ReadyQueue::Order order      = ReadyQueue::Order::MIN_KEY;
+    static constexpr Preemption        preemption = Preemption::STRICT;
+    static constexpr int               LEVELS     = 3;
+
+    static int level(const SchedContext& c, int idx) {
+        return c.live.levelEpoch[idx] == c.boostEpoch ? c.live.level[idx] : 0;
+    }
+    static int used(const SchedContext& c, int idx) {
+        return c.live.levelEpoch[idx] == c.boostEpoch ? c.live.levelUsed[idx] : 0;
+    }
+    static int quantumOf(const SchedContext& c, int idx) { return c.quantum << level(c, idx); }
+
+    // Aplica los boosts pendientes antes de modificar el nivel
+    static void touch(SchedContext& c, int idx) {
+        if (c.live.levelEpoch[idx] == c.boostEpoch) return;
+        c.live.level[idx]      = 0;
+        c.live.levelUsed[idx]  = 0;
+        c.live.levelEpoch[idx] = c.boostEpoch;
+    }
+
+    static long long key(const SchedContext& c, int idx) {
+        return (long long)c.boostEpoch * LEVELS + level(c, idx);
+    }
+    static long long runningKey(const SchedContext& c, int idx) { return level(c, idx); }
+    static long long effectiveKey(const SchedContext& c, long long key) {
+        return key / LEVELS < c.boostEpoch ? 0 : key % LEVELS;
+    }
+
+    static void beginTick(SchedContext& c) {
+        if (c.boostPeriod > 0 && c.cycle > 0 && c.cycle % c.boostPeriod == 0)
+            c.boostEpoch++;
+    }
+    static bool expire(SchedContext& c, int, int idx) {
+        if (used(c, idx) < quantumOf(c, idx)) return false;
+        touch(c, idx);
+        if (c.live.level[idx] < LEVELS - 1) c.live.level[idx]++;
+        c.live.levelUsed[idx] = 0;
+        return true;
+    }
+    static void onRun(SchedContext& c, int idx, int k) {
+        touch(c, idx);
+        c.live.levelUsed[idx] += k;
+    }
+    static int quietLimit(const SchedContext& c, int, int idx, const ReadyQueue&) {
+        return quantumOf(c, idx) - used(c, idx);
+    }
+    static int nextEvent(const SchedContext& c) {
+        if (c.boostPeriod <= 0) return INT_MAX;
+        int nextBoost = (c.cycle / c.boostPeriod + 1) * c.boostPeriod;
+        return nextBoost - c.cycle - 1;
+    }
+};
@@ -8,6 +8,10 @@
 #include <stdexcept>
 #include <iostream>
 #include <unordered_map>
+#include <numeric>
+#include <climits>
+#include <cstdint>
+#include <iterator>
 
 SimulationEngine::SimulationEngine(
     const std::vector<Process>& procs,
@@ -15,490 +19,747 @@ SimulationEngine::SimulationEngine(
     const std::vector<Action>& acts,
     SchedulingAlgo algo,
     int rrQuantum
-) : origProcs_(procs)
-  , origRes_(res)
-  , origActs_(acts)
-  , algo_(algo)
-  , rrQuantum_(rrQuantum)
+) : SimulationEngine(CompiledWorkload::compile(procs, res, acts), algo, rrQuantum)
+{}
+
+SimulationEngine::SimulationEngine(
+    const BinaryWorkload& w,
+    SchedulingAlgo algo,
+    int rrQuantum
+) : SimulationEngine(CompiledWorkload::compile(w), algo, rrQuantum)
+{}
+
+SimulationEngine::SimulationEngine(
+    std::shared_ptr<const CompiledWorkload> workload,
+    SchedulingAlgo algo,
+    int rrQuantum
+) : rrQuantum_(rrQuantum)
+  , wl_(std::move(workload))
 {
+    sync_.table = &wl_->resources;
+    setAlgorithm(algo);
     reset();
 }
 
-void SimulationEngine::reset() {
-    cycle_            = -1;
-    rrCounter_        = 0;
-    runningIdx_       = -1;
-    res_              = origRes_;
-    acts_             = origActs_;
-    readyQueue_.clear();
-    executionHistory_.clear();
-    procs_            = origProcs_;
-
-    for (auto& p : procs_) {
-        p.remaining = p.burst;          // Tiempo restante de ejecución
-        p.completionTime = -1;          // Aún no se ha completado
+void SimulationEngine::setAlgorithm(SchedulingAlgo algo) {
+    algo_ = algo;
+    switch (algo) {
+        case SchedulingAlgo::FIFO:     ops_ = &opsFor<FifoPolicy>();       break;
+        case SchedulingAlgo::SJF:      ops_ = &opsFor<SjfPolicy>();        break;
+        case SchedulingAlgo::SRT:      ops_ = &opsFor<SrtPolicy>();        break;
+        case SchedulingAlgo::RR:       ops_ = &opsFor<RoundRobinPolicy>(); break;
+        case SchedulingAlgo::PRIORITY: ops_ = &opsFor<PriorityPolicy>();   break;
+        case SchedulingAlgo::CFS:      ops_ = &opsFor<CfsPolicy>();        break;
+        case SchedulingAlgo::MLFQ:     ops_ = &opsFor<MlfqPolicy>();       break;
     }
+}
 
-    if (algo_ == SchedulingAlgo::SJF ||
-        algo_ == SchedulingAlgo::PRIORITY) {
-        // Carga todos los procesos en la cola de listos de golpe
-        for (int i = 0; i < (int)procs_.size(); ++i) {
-            readyQueue_.push_back(i);
-        }
-    }
+void SimulationEngine::setCores(int cores, CoreBalancing balancing) {
+    if (cores < 1)
+        throw std::invalid_argument("Se necesita al menos un núcleo");
+    running_.assign(cores, -1);
+    balancing_ = balancing;
+    reset();
+}
+
+void SimulationEngine::reset() {
+    const int cores   = coreCount();
+    cycle_            = -1;
+    std::fill(running_.begin(), running_.end(), -1);
+    slice_.assign(cores, 0);
+    histories_.assign(cores, ExecutionHistory{});
+    coreChanged_.assign(cores, 0);
+    minVruntime_      = 0;
+    boostEpoch_       = 0;
+    version_++;
+
+    const size_t n    = wl_->burst.size();
+    doneCount_        = 0;
+    metrics_          = Metrics{};
+    metrics_.cores.assign(cores, CoreMetrics{});
+    procMetrics_.assign(n, ProcessMetrics{});
+    live_.reset(wl_->burst);               // remaining = burst, sin completar
+    for (int32_t r : live_.remaining)
+        if (r <= 0) doneCount_++;
+    nextArrivalPos_ = 0;
+
+    // Sin índice por proceso: con una cola por núcleo sería O(núcleos × n);
+    // la pertenencia se lleva en live_.queued
+    queues_.resize(balancing_ == CoreBalancing::GLOBAL ? 1 : cores);
+    for (ReadyQueue& q : queues_)
+        q.reset(ops_->order, (int)n, false);
+    queuedCount_ = 0;
 
     syncLog_.clear();
+    syncTimeline_.clear();
 
     sync_.mutexes.clear();
     sync_.semaphores.clear();
-
-    maxSyncCycle_ = 0;
-    for (auto &a : origActs_) {
-        if (a.cycle > maxSyncCycle_)
-            maxSyncCycle_ = a.cycle;
+    sync_.rwlocks.clear();
+    const ResourceTable& table = wl_->resources;
+    for (size_t r = 0; r < table.kinds.size(); ++r) {
+        switch (table.kinds[r]) {
+            case ResourceKind::MUTEX:     sync_.mutexes.emplace_back();                   break;
+            case ResourceKind::SEMAPHORE: sync_.semaphores.emplace_back(table.capacity[r]); break;
+            case ResourceKind::RWLOCK:    sync_.rwlocks.emplace_back(table.rwPolicy[r]);    break;
+        }
     }
+    waitFor_.reset(n, table.kinds.size());
+    for (int a : wl_->resSignals)
+        waitFor_.addSignal(wl_->acts[a].proc, wl_->acts[a].res);
+
+    nextBucket_ = 0;
 
-    for (auto &r : origRes_) {
-        if (r.count == 1)
-            sync_.mutexes[r.name] = Mutex{};
-        else
-            sync_.semaphores[r.name] = Semaphore(r.count);
-    }
 }
 
-bool SimulationEngine::isMutex(const std::string& name) const {
-    return sync_.mutexes.count(name) > 0;
+const std::string& SimulationEngine::unknownResName(const SyncOp& op) const {
+    return wl_->undeclaredRes[-op.res - 1];
 }
 
 bool SimulationEngine::isFinished() const {
-    bool allDone = std::all_of(procs_.begin(), procs_.end(),
-        [](const auto& p){ return p.remaining <= 0; });
-    return allDone && runningIdx_ < 0 && readyQueue_.empty();
+    if (queuedCount_ != 0) return false;
+    for (int idx : running_)
+        if (idx >= 0) return false;
+    if (doneCount_ == (int)live_.size()) return true;
+    // En UNIFIED los que faltan pueden estar todos bloqueados: sin nadie que
+    // corra ni por llegar, ya no hay quien los despierte
+    return mode_ == SimMode::UNIFIED && nextArrivalPos_ == wl_->arrivalOrder.size();
 }
 
 int SimulationEngine::currentCycle() const { return cycle_; }
-int SimulationEngine::runningIndex() const  { return runningIdx_; }
-const std::vector<Process>& SimulationEngine::procs() const { return procs_; }
-const std::deque<int>&       SimulationEngine::readyQueue() const { return readyQueue_; }
 
-void SimulationEngine::tick() {
-
-    if (mode_ == SimMode::SYNCHRONIZATION && cycle_ >= maxSyncCycle_) {
-        return;
-    }
-    
-    cycle_++;
-
-    if (mode_ == SimMode::SCHEDULING) {
-        // 1) arrivals
-        if (algo_ == SchedulingAlgo::FIFO || 
-            algo_ == SchedulingAlgo::SRT  ||
-            algo_ == SchedulingAlgo::RR) {
-            handleArrivals();
+const std::vector<Process>& SimulationEngine::procs() const {
+    if (viewVersion_ != version_ || !procsView_) {
+        auto view = std::make_shared<std::vector<Process>>(wl_->procs());
+        for (size_t i = 0; i < view->size(); ++i) {
+            Process& p = (*view)[i];
+            p.remaining        = live_.remaining[i];
+            p.completionTime   = live_.completion[i];
+            p.state            = live_.state[i];
+            p.justGrantedMutex = live_.justGrantedMutex[i] != 0;
         }
+        procsView_   = std::move(view);
+        viewVersion_ = version_;
+    }
+    return *procsView_;
+}
+const ReadyQueue& SimulationEngine::readyQueue(int core) const {
+    return queues_[balancing_ == CoreBalancing::GLOBAL ? 0 : core];
+}
 
-        // 2) scheduling
-        bool preemptivo = (algo_==SchedulingAlgo::SRT ||
-                           algo_==SchedulingAlgo::RR ||
-                           algo_==SchedulingAlgo::PRIORITY);
-        if (preemptivo || runningIdx_ < 0) {
-            scheduleNext();
-        }
+void SimulationEngine::pushReady(int q, int idx, long long key, long long seq) {
+    queues_[q].push(idx, key, seq);
+    live_.queued[idx] = 1;
+    queuedCount_++;
+}
 
-        // 3) record & execute
-        executionHistory_.push_back(
-            runningIdx_>=0 ? procs_[runningIdx_].pid : "idle"
-        );
-        executeRunning();
+int SimulationEngine::popReady(int q) {
+    int idx = queues_[q].pop();
+    live_.queued[idx] = 0;
+    queuedCount_--;
+    return idx;
+}
 
-    } else {
-        // —————— MODO SYNCHRONIZATION ——————
-        handleSyncActions();
+// Cola con menos trabajo (encolados + el que corre); a igualdad, la primera
+int SimulationEngine::leastLoadedQueue() const {
+    int best = 0;
+    size_t bestLoad = SIZE_MAX;
+    for (int q = 0; q < (int)queues_.size() && bestLoad > 0; ++q) {
+        size_t load = queues_[q].size() + (running_[q] >= 0 ? 1 : 0);
+        if (load < bestLoad) { best = q; bestLoad = load; }
     }
+    return best;
 }
 
-void SimulationEngine::handleArrivals() {
-    for (int i = 0; i < (int)procs_.size(); ++i) {
-        if (procs_[i].arrival == cycle_) {
-            readyQueue_.push_back(i);
-        }
+void SimulationEngine::setCheckpointInterval(int k) {
+    checkpointInterval_ = std::max(0, k);
+    checkpointStride_   = checkpointInterval_;
+    checkpoints_.clear();
+    checkpointKey_ = currentKey();
+}
+
+// El pasado guardado sólo sirve si se simuló con la misma configuración
+void SimulationEngine::validateCheckpoints() {
+    if (!(checkpointKey_ == currentKey())) {
+        checkpoints_.clear();
+        checkpointStride_ = checkpointInterval_;
+        checkpointKey_    = currentKey();
     }
 }
 
-int SimulationEngine::findProcessIndex(const std::string& pid) const {
-    for (int i = 0; i < (int)procs_.size(); ++i) {
-        if (procs_[i].pid == pid)
-            return i;
+void SimulationEngine::maybeCheckpoint() {
+    if (checkpointInterval_ <= 0) return;
+    validateCheckpoints();
+    // al re-simular tras un seekTo los ciclos ya cubiertos no se vuelven a guardar
+    int last = checkpoints_.empty() ? -1 : checkpoints_.back()->cycle;
+    if (cycle_ < (long long)last + checkpointStride_) return;
+
+    checkpoints_.push_back(std::make_shared<const Checkpoint>(Checkpoint{
+        cycle_, live_, sync_.mutexes, sync_.semaphores, sync_.rwlocks, waitFor_, queues_,
+        metrics_, procMetrics_, nextBucket_, nextArrivalPos_, syncLog_.size(),
+        queuedCount_, minVruntime_, boostEpoch_, histories_[0].cycles(), doneCount_, slice_, running_
+    }));
+
+    // Cada checkpoint copia toda la tabla de procesos: con el tope alcanzado se
+    // queda uno de cada dos y se espacian el doble, así la memoria no crece
+    // con el largo de la corrida
+    if (checkpoints_.size() >= MAX_CHECKPOINTS) {
+        size_t kept = 0;
+        for (size_t i = 0; i < checkpoints_.size(); i += 2)
+            checkpoints_[kept++] = std::move(checkpoints_[i]);
+        checkpoints_.resize(kept);
+        checkpointStride_ *= 2;
     }
-    return -1; // No encontrado
 }
 
-void SimulationEngine::handleSyncActions() {
-    for (auto &act : acts_) {
-        if (act.cycle != cycle_) 
-            continue;
+void SimulationEngine::restore(const Checkpoint& cp) {
+    cycle_            = cp.cycle;
+    version_++;
+    live_             = cp.live;
+    sync_.mutexes     = cp.mutexes;
+    sync_.semaphores  = cp.semaphores;
+    sync_.rwlocks     = cp.rwlocks;
+    waitFor_          = cp.waitFor;
+    queues_           = cp.queues;
+    metrics_          = cp.metrics;
+    procMetrics_      = cp.procMetrics;
+    nextBucket_       = cp.nextBucket;
+    nextArrivalPos_   = cp.nextArrivalPos;
+    queuedCount_      = cp.queuedCount;
+    minVruntime_      = cp.minVruntime;
+    boostEpoch_       = cp.boostEpoch;
+    slice_            = cp.slice;
+    doneCount_        = cp.doneCount;
+    running_          = cp.running;
+    syncLog_.erase(syncLog_.begin() + cp.syncLogSize, syncLog_.end());
+    syncTimeline_.truncate(cp.syncLogSize);
+    for (ExecutionHistory& h : histories_)
+        h.truncate(cp.historyCycles);
+}
 
-        int idx = findProcessIndex(act.pid);
-        if (idx < 0) 
-            continue;
+void SimulationEngine::seekTo(int cycle) {
+    validateCheckpoints();
 
-        Process& p = procs_[idx];
+    if (cycle < cycle_) {
+        // Último checkpoint con ciclo <= cycle; sin ninguno, desde el inicio
+        auto it = std::upper_bound(checkpoints_.begin(), checkpoints_.end(), cycle,
+            [](int c, const std::shared_ptr<const Checkpoint>& cp){ return c < cp->cycle; });
+        if (it == checkpoints_.begin()) reset();
+        else                            restore(**std::prev(it));
+    }
+    runUntil(cycle);
+}
 
-        if (act.type == "SIGNAL" && p.state == ProcState::BLOCKED) {
-            // si sigue bloqueado, no puede ejecutar SIGNAL
+// Ciclos hasta el siguiente bucket de acciones (modo SYNCHRONIZATION)
+int SimulationEngine::syncQuietCycles() {
+    if (cycle_ >= wl_->maxSyncCycle) return 0;
+    const auto& buckets = wl_->buckets;
+    while (nextBucket_ < buckets.size() &&
+           buckets[nextBucket_].cycle <= cycle_)
+        nextBucket_++;
+    int target = nextBucket_ < buckets.size()
+               ? buckets[nextBucket_].cycle - 1
+               : wl_->maxSyncCycle;
+    return std::max(0, target - cycle_);
+}
+
+// Registra en cada núcleo `k` ciclos del proceso en ejecución (o de CPU
+// ociosa) que terminan en cycle_: historial, contadores de CPU y primer despacho
+void SimulationEngine::recordCycles(int k) {
+    for (int c = 0; c < coreCount(); ++c) {
+        const int idx = running_[c];
+        histories_[c].append(idx, k);
+        CoreMetrics& core = metrics_.cores[c];
+        if (idx < 0) {
+            core.idleCycles     += k;
+            metrics_.idleCycles += k;
             continue;
         }
 
-        // Helper para registrar evento
-        auto logEvent = [&](SyncResult r, SyncAction a){
-            syncLog_.push_back({ cycle_, idx, act.res, r, a });
-        };
-
-        auto logEventAt = [&](int evCycle, SyncResult r, SyncAction a){
-            syncLog_.push_back({ evCycle,    
-                                    idx,
-                                    act.res,
-                                    r,
-                                    a 
-                                });
-        };
-
-        // —— LECTURA / ESCRITURA ——
-        if (act.type == "READ" || act.type == "WRITE") {
-            // Si es semáforo: mantengo la lógica existente
-            if (sync_.semaphores.count(act.res) > 0) {
-                auto &s = sync_.semaphores[act.res];
-                SyncAction accionLog = (act.type == "READ") ? SyncAction::READ : SyncAction::WRITE;
-                if (s.count > 0) {
-                    s.count--;
-                    logEvent(SyncResult::ACCESSED, accionLog);
-                } else {
-                    p.state = ProcState::BLOCKED;
-                    s.waitQueue.push_back({ idx, accionLog }); 
-                    logEvent(SyncResult::WAITING, accionLog);
-                }
-                continue;
-            }
+        core.busyCycles     += k;
+        metrics_.busyCycles += k;
+        ProcessMetrics& pm = procMetrics_[idx];
+        if (pm.firstRun < 0) {
+            pm.firstRun = cycle_ - k + 1;
+            pm.response = pm.firstRun - wl_->arrival[idx];
+            metrics_.onFirstRun(pm);
+        }
+    }
+}
 
-            // Si es mutex, verificar que el proceso sea owner y luego loguear
-            if (sync_.mutexes.count(act.res) > 0) {
-                auto &m = sync_.mutexes[act.res];
-                SyncAction accionLog = (act.type == "READ") ? SyncAction::READ : SyncAction::WRITE;
-
-                // Solo el dueño (ownerIdx) puede hacer READ/WRITE
-                if (m.ownerIdx == idx) {
-                    logEvent(SyncResult::ACCESSED, accionLog);
-                } else {
-                    std::cerr << "[Error] Proceso " << p.pid
-                            << " intenta hacer “" << act.type 
-                            << "” sobre mutex “" << act.res 
-                            << "” sin haber hecho ADQUIRE.\n";
-                }
-                continue;
-            }
+void SimulationEngine::handleSyncActions() {
+    // Sólo se recorre el bucket de acciones de este ciclo
+    const auto& buckets = wl_->buckets;
+    while (nextBucket_ < buckets.size() &&
+           buckets[nextBucket_].cycle < cycle_)
+        nextBucket_++;
+    if (nextBucket_ == buckets.size() ||
+        buckets[nextBucket_].cycle != cycle_)
+        return;
 
-            // Si no se encontró en semáforos ni en mutexes → error
-            std::cerr << "[Error] Recurso \"" << act.res
-                    << "\" no encontrado en semáforos ni en mutexes.\n";
-            return; 
-        } else if (act.type == "ADQUIRE") {
+    const auto& bucket = buckets[nextBucket_++];
+    const size_t logStart = syncLog_.size();
 
-            auto &m = sync_.mutexes[act.res];
+    for (int a = bucket.begin; a < bucket.end; ++a) {
+        curAct_ = a;
+        if (!applySyncAction(wl_->acts[a])) break;
+    }
 
-            // Ya es el dueño → error
-            if (m.ownerIdx == idx) {
-                std::cerr << "[Error] Proceso " << idx << " ya es dueño del mutex " << act.res
-                        << " y volvió a hacer ADQUIRE." << std::endl;
-                continue;
-            }
+    indexSyncEvents(logStart);
+}
 
-            // Acaba de recibir el mutex por RELEASE → no debe volver a hacer ADQUIRE
-            if (procs_[idx].justGrantedMutex) {
-                std::cerr << "[Error] Proceso " << idx << " ya recibió el mutex automáticamente en "
-                        << "el ciclo anterior, no debe volver a pedir ADQUIRE." << std::endl;
-                continue;
-            }
+// Aplica una acción en cycle_; false si el resto del bucket no debe seguir
+bool SimulationEngine::applySyncAction(const SyncOp& act) {
+    int idx = act.proc;
+    if (idx < 0) 
+        return true;
+
+    ProcState& state = live_.state[idx];
+    const std::string_view pid = wl_->pid(idx);
+
+    // el SIGNAL deja de estar pendiente, se aplique o no
+    if (wl_->isSemSignal(act))
+        waitFor_.dropSignal(idx, act.res);
+
+    if (act.type == SyncAction::SIGNAL && state == ProcState::BLOCKED) {
+        // si sigue bloqueado, no puede ejecutar SIGNAL: quien lo esperaba
+        // puede haber quedado sin salida
+        if (act.res >= 0 && sync_.kind(act.res) == ResourceKind::SEMAPHORE)
+            reportLostSignal(act.res);
+        return true;
+    }
 
-            // intento atómico de adquirir
-            if (!m.locked) {
-                // si estaba libre, me lo quedo
-                m.locked   = true;
-                m.ownerIdx = idx;
-                logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::ADQUIRE);
-            } else {
-                // si estaba ocupado, me bloqueo hasta un RELEASE futuro
-                p.state = ProcState::BLOCKED;
-                m.waitQueue.push_back(idx);
-                logEventAt(cycle_, SyncResult::WAITING, SyncAction::ADQUIRE);
-            }
+    // Helper para registrar evento
+    auto logEvent = [&](SyncResult r, SyncAction a){
+        syncLog_.push_back({ cycle_, idx, act.res, r, a });
+    };
+
+    auto logEventAt = [&](int evCycle, SyncResult r, SyncAction a){
+        syncLog_.push_back({ evCycle,    
+                                idx,
+                                act.res,
+                                r,
+                                a 
+                            });
+    };
+
+    // —— RW LOCK: READ / WRITE lo toman, RELEASE lo suelta ——
+    if (act.res >= 0 && sync_.isRwLock(act.res)) {
+        if (act.type == SyncAction::READ || act.type == SyncAction::WRITE)
+            rwAcquire(idx, act.res, act.type == SyncAction::WRITE);
+        else if (act.type == SyncAction::RELEASE)
+            rwRelease(idx, act.res);
+        else
+            std::cerr << "[Error] " << syncActionName(act.type) << " sobre \""
+                      << sync_.name(act.res) << "\", que es un RW lock.\n";
+        return true;
+    }
 
-        } else if (act.type == "RELEASE") {
-            auto &m = sync_.mutexes[act.res];
+    // —— LECTURA / ESCRITURA ——
+    if (act.type == SyncAction::READ || act.type == SyncAction::WRITE) {
+        SyncAction accionLog = act.type;
 
-            // Verificar que el proceso idx sea el dueño actual:
-            if (m.ownerIdx != idx) {
-                std::cerr << "[Error] Ciclo " << cycle_ 
-                        << ": Proceso " << p.pid
-                        << " intenta RELEASE(\"" << act.res 
-                        << "\") sin haber hecho ACQUIRE.\n";
-                continue;  
+        // Si es semáforo: mantengo la lógica existente
+        if (act.res >= 0 && !sync_.isMutex(act.res)) {
+            auto &s = sync_.semaphore(act.res);
+            if (s.count > 0) {
+                s.count--;
+                waitFor_.addHolder(act.res, idx);
+                logEvent(SyncResult::ACCESSED, accionLog);
+            } else {
+                block(idx);
+                s.waitQueue.push_back({ idx, accionLog }); 
+                waitFor_.addWait(idx, act.res);
+                logEvent(SyncResult::WAITING, accionLog);
+                reportDeadlock(idx);
             }
+            return true;
+        }
+
+        // Si es mutex, verificar que el proceso sea owner y luego loguear
+        if (act.res >= 0) {
+            auto &m = sync_.mutex(act.res);
 
-            // Si sí es dueño, procedes a liberar:
-            logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::RELEASE);
-            if (!m.waitQueue.empty()) {
-                // Pasas la propiedad al siguiente bloqueado…
-                int next = m.waitQueue.front();
-                m.waitQueue.pop_front();
-                m.ownerIdx = next;
-                procs_[next].state = ProcState::READY;
-                readyQueue_.push_back(next);
-                // Logueas ADQUIRE automático…
-                syncLog_.push_back({
-                    cycle_, next, act.res,
-                    SyncResult::ACCESSED,
-                    SyncAction::ADQUIRE
-                });
+            // Solo el dueño (ownerIdx) puede hacer READ/WRITE
+            if (m.ownerIdx == idx) {
+                logEvent(SyncResult::ACCESSED, accionLog);
             } else {
-                // Si no hay nadie en cola, liberas el mutex por completo:
-                m.locked = false;
-                m.ownerIdx = -1;
+                std::cerr << "[Error] Proceso " << pid
+                        << " intenta hacer “" << syncActionName(act.type)
+                        << "” sobre mutex “" << sync_.name(act.res)
+                        << "” sin haber hecho ADQUIRE.\n";
             }
-        } else if (act.type == "WAIT") {
-            auto &s = sync_.semaphores[act.res];
+            return true;
+        }
 
-            SyncAction accionLog = (act.type == "READ") ? SyncAction::READ : SyncAction::WRITE;
+        // Si no se encontró en semáforos ni en mutexes → error
+        std::cerr << "[Error] Recurso \"" << unknownResName(act)
+                << "\" no encontrado en semáforos ni en mutexes.\n";
+        return false;
+    }
 
-            if (s.count > 0) {
-                // adquisición atómica
-                s.count--;
-                logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::WAIT);
-                p.acquiredSemaphores.insert(act.res);
+    // ADQUIRE / RELEASE sólo sobre mutex; WAIT / SIGNAL sólo sobre semáforo
+    bool wantsMutex = (act.type == SyncAction::ADQUIRE ||
+                       act.type == SyncAction::RELEASE);
+    if (act.res < 0 || sync_.isMutex(act.res) != wantsMutex) {
+        std::cerr << "[Error] " << syncActionName(act.type) << " sobre \""
+                  << (act.res < 0 ? unknownResName(act) : sync_.name(act.res))
+                  << "\", que no es " << (wantsMutex ? "un mutex" : "un semáforo")
+                  << ".\n";
+        return true;
+    }
 
-            } else {
-                // bloqueo
-                p.state = ProcState::BLOCKED;
-                s.waitQueue.push_back({ idx, accionLog });
-                logEventAt(cycle_, SyncResult::WAITING, accionLog);
-            }
+    if (act.type == SyncAction::ADQUIRE) {
 
-        } else if (act.type == "SIGNAL") {
-            auto &s = sync_.semaphores[act.res];
+        auto &m = sync_.mutex(act.res);
 
-            // Primero, dibujamos el SIGNAL del proceso que lo llamó
-            logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::SIGNAL);
+        // Ya es el dueño → error
+        if (m.ownerIdx == idx) {
+            std::cerr << "[Error] Proceso " << idx << " ya es dueño del mutex " << sync_.name(act.res)
+                    << " y volvió a hacer ADQUIRE." << std::endl;
+            return true;
+        }
 
-            if (!s.waitQueue.empty()) {
-                auto frontPair = s.waitQueue.front();
-                s.waitQueue.pop_front();
+        // Acaba de recibir el mutex por RELEASE → no debe volver a hacer ADQUIRE
+        if (live_.justGrantedMutex[idx]) {
+            std::cerr << "[Error] Proceso " << idx << " ya recibió el mutex automáticamente en "
+                    << "el ciclo anterior, no debe volver a pedir ADQUIRE." << std::endl;
+            return true;
+        }
 
-                int nextIdx = frontPair.first;               
-                SyncAction blockedAction = frontPair.second;
+        // intento atómico de adquirir
+        if (!m.locked) {
+            // si estaba libre, me lo quedo
+            m.locked   = true;
+            m.ownerIdx = idx;
+            waitFor_.addHolder(act.res, idx);
+            logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::ADQUIRE);
+        } else {
+            // si estaba ocupado, me bloqueo hasta un RELEASE futuro
+            block(idx);
+            m.waitQueue.push_back(idx);
+            waitFor_.addWait(idx, act.res);
+            logEventAt(cycle_, SyncResult::WAITING, SyncAction::ADQUIRE);
+            reportDeadlock(idx);
+        }
 
-                procs_[nextIdx].state = ProcState::READY;
-                readyQueue_.push_back(nextIdx);
+    } else if (act.type == SyncAction::RELEASE) {
+        auto &m = sync_.mutex(act.res);
 
-                syncLog_.push_back({
-                    cycle_,
-                    nextIdx,
-                    act.res,
-                    SyncResult::ACCESSED,
-                    SyncAction::WAKE
-                });
+        // Verificar que el proceso idx sea el dueño actual:
+        if (m.ownerIdx != idx) {
+            std::cerr << "[Error] Ciclo " << cycle_ 
+                    << ": Proceso " << pid
+                    << " intenta RELEASE(\"" << sync_.name(act.res)
+                    << "\") sin haber hecho ACQUIRE.\n";
+            return true;  
+        }
 
-                syncLog_.push_back({
-                    cycle_,
-                    nextIdx,
-                    act.res,
-                    SyncResult::ACCESSED,
-                    blockedAction
-                });
+        // Si sí es dueño, procedes a liberar:
+        logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::RELEASE);
+        waitFor_.removeHolder(act.res, idx);
+        if (!m.waitQueue.empty()) {
+            // Pasas la propiedad al siguiente bloqueado…
+            int next = m.waitQueue.front();
+            m.waitQueue.pop_front();
+            m.ownerIdx = next;
+            wake(next);
+            // Logueas ADQUIRE automático…
+            syncLog_.push_back({
+                cycle_, next, act.res,
+                SyncResult::ACCESSED,
+                SyncAction::ADQUIRE
+            });
+            waitFor_.wake(next);
+            waitFor_.addHolder(act.res, next);
+        } else {
+            // Si no hay nadie en cola, liberas el mutex por completo:
+            m.locked = false;
+            m.ownerIdx = -1;
+        }
+    } else if (act.type == SyncAction::WAIT) {
+        auto &s = sync_.semaphore(act.res);
+
+        // (se registra como WRITE bloqueado, igual que antes)
+        SyncAction accionLog = SyncAction::WRITE;
+
+        if (s.count > 0) {
+            // adquisición atómica
+            s.count--;
+            waitFor_.addHolder(act.res, idx);
+            logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::WAIT);
+
+        } else {
+            // bloqueo
+            block(idx);
+            s.waitQueue.push_back({ idx, accionLog });
+            waitFor_.addWait(idx, act.res);
+            logEventAt(cycle_, SyncResult::WAITING, accionLog);
+            reportDeadlock(idx);
+        }
 
-            } else {
-                // Si no había nadie esperando, incrementamos el contador como antes
-                s.count++;
-            }
+    } else if (act.type == SyncAction::SIGNAL) {
+        auto &s = sync_.semaphore(act.res);
+
+        // Primero, dibujamos el SIGNAL del proceso que lo llamó
+        logEventAt(cycle_, SyncResult::ACCESSED, SyncAction::SIGNAL);
+        // la unidad que devuelve deja de ser suya (si la había tomado)
+        waitFor_.removeHolder(act.res, idx);
+
+        if (!s.waitQueue.empty()) {
+            auto frontPair = s.waitQueue.front();
+            s.waitQueue.pop_front();
+
+            int nextIdx = frontPair.first;               
+            SyncAction blockedAction = frontPair.second;
+
+            wake(nextIdx);
+
+            syncLog_.push_back({
+                cycle_,
+                nextIdx,
+                act.res,
+                SyncResult::ACCESSED,
+                SyncAction::WAKE
+            });
+
+            syncLog_.push_back({
+                cycle_,
+                nextIdx,
+                act.res,
+                SyncResult::ACCESSED,
+                blockedAction
+            });
+            waitFor_.wake(nextIdx);
+            waitFor_.addHolder(act.res, nextIdx);
+
+        } else {
+            // Si no había nadie esperando, incrementamos el contador como antes
+            s.count++;
         }
     }
+    return true;
+}
 
-    std::sort(syncLog_.begin(), syncLog_.end(),
+// Los eventos desde `from` son todos de cycle_: basta ordenarlos por proceso
+// (estable: dentro de un proceso se conserva el orden de emisión) e indexarlos
+void SimulationEngine::indexSyncEvents(size_t from) {
+    std::stable_sort(syncLog_.begin() + from, syncLog_.end(),
         [](auto const &a, auto const &b){
-            if (a.cycle != b.cycle) return a.cycle < b.cycle;
             return a.pidIdx < b.pidIdx;
         }
     );
+    for (size_t e = from; e < syncLog_.size(); ++e) {
+        const SyncEvent& ev = syncLog_[e];
+        if (ev.res >= 0)
+            syncTimeline_.append((int)e, ev.cycle, wl_->resources.kinds[ev.res]);
+    }
 }
 
-void SimulationEngine::scheduleNext() {
-    switch(algo_) {
+// Un lector entra si no hay escritor y la política no le da paso a quien
+// espera; un escritor, sólo con el lock libre (libre implica colas vacías:
+// al soltarlo se concede enseguida)
+void SimulationEngine::rwAcquire(int idx, int res, bool write) {
+    RwLock& l = sync_.rwlock(res);
+    const SyncAction action = write ? SyncAction::WRITE : SyncAction::READ;
+
+    if (l.writerIdx == idx ||
+        std::find(l.readers.begin(), l.readers.end(), idx) != l.readers.end()) {
+        std::cerr << "[Error] Proceso " << wl_->pid(idx) << " ya tiene el RW lock "
+                  << sync_.name(res) << " y volvió a pedir " << syncActionName(action) << ".\n";
+        return;
+    }
 
-        // Algoritmo FIFO
-        case SchedulingAlgo::FIFO:
-        if (runningIdx_<0 && !readyQueue_.empty()) {
-            runningIdx_ = readyQueue_.front();
-            readyQueue_.pop_front();
-        }
-        break;
-
-        // Algoritmo Shortest Job Fist
-        case SchedulingAlgo::SJF:
-        {
-            if (runningIdx_ < 0 && !readyQueue_.empty()) {
-                auto it = std::min_element(
-                    readyQueue_.begin(), readyQueue_.end(),
-                    [&](int a, int b) {
-                        bool aReady = procs_[a].arrival <= cycle_;
-                        bool bReady = procs_[b].arrival <= cycle_;
-
-                        if (aReady && !bReady) return true;
-                        if (!aReady && bReady) return false;
-                        if (!aReady && !bReady) return false; // ninguno listo aún
-
-                        return procs_[a].burst < procs_[b].burst;
-                    }
-                );
-
-                // Si alguno estaba listo
-                if (procs_[*it].arrival <= cycle_) {
-                    runningIdx_ = *it;
-                    readyQueue_.erase(it);
-                }
-            }
+    bool enters;
+    if (write) {
+        enters = l.free();
+    } else {
+        switch (l.policy) {
+            case RwPolicy::READERS: enters = l.writerIdx < 0;                             break;
+            case RwPolicy::WRITERS: enters = l.writerIdx < 0 && l.writeQueue.empty();     break;
+            default:                enters = l.writerIdx < 0 && l.writeQueue.empty() &&
+                                             l.readQueue.empty();                         break;
         }
-        break;
-
-        // Algoritmo Shortest Remaining Time (SRT)
-        case SchedulingAlgo::SRT:
-        {
-            // Reunir procesos disponibles
-            std::vector<int> available;
-            for (int i : readyQueue_) {
-                if (procs_[i].arrival <= cycle_) {
-                    available.push_back(i);
-                }
-            }
-
-            // Incluir el running actual si sigue vivo y llegó
-            if (runningIdx_ >= 0 && procs_[runningIdx_].arrival <= cycle_) {
-                available.push_back(runningIdx_);
-            }
+    }
 
-            if (!available.empty()) {
-                // Elegir el que tenga menor remaining time
-                auto it = std::min_element(
-                    available.begin(), available.end(),
-                    [&](int a, int b) {
-                        return procs_[a].remaining < procs_[b].remaining;
-                    }
-                );
-
-                int chosen = *it;
-
-                if (chosen != runningIdx_) {
-                    // Preempt → si el actual no es el mismo
-                    if (runningIdx_ >= 0)
-                        readyQueue_.push_back(runningIdx_);
-
-                    // Remove from readyQueue_
-                    auto pos = std::find(readyQueue_.begin(), readyQueue_.end(), chosen);
-                    if (pos != readyQueue_.end())
-                        readyQueue_.erase(pos);
-
-                    runningIdx_ = chosen;
-                }
-            } else {
-                // Nada listo
-                runningIdx_ = -1;
-            }
-        }
-        break;
-
-        //Algoritmo Priority Scheduling
-        case SchedulingAlgo::PRIORITY:
-        {
-            int nextIdx = -1;
-
-            // Buscar el más prioritario entre los disponibles
-            for (int i : readyQueue_) {
-                if (procs_[i].arrival <= cycle_) { // ← AGREGAR ESTA CONDICIÓN
-                    if (nextIdx == -1 || procs_[i].priority < procs_[nextIdx].priority) {
-                        nextIdx = i;
-                    }
-                }
-            }
+    if (enters) {
+        rwEnter(idx, res, write, cycle_);
+        return;
+    }
+    block(idx);
+    (write ? l.writeQueue : l.readQueue).push_back({ idx, cycle_, l.nextTurn++ });
+    waitFor_.addWait(idx, res);
+    syncLog_.push_back({ cycle_, idx, res, SyncResult::WAITING, action });
+    reportDeadlock(idx);
+}
 
-            // Ver si hay uno más prioritario que el actual
-            if (nextIdx >= 0 &&
-                (runningIdx_ < 0 || procs_[nextIdx].priority < procs_[runningIdx_].priority))
-            {
-                if (runningIdx_ >= 0)
-                    readyQueue_.push_back(runningIdx_);
-
-                runningIdx_ = nextIdx;
-                auto pos = std::find(readyQueue_.begin(), readyQueue_.end(), nextIdx);
-                if (pos != readyQueue_.end())
-                    readyQueue_.erase(pos);
-            }
+void SimulationEngine::rwRelease(int idx, int res) {
+    RwLock& l = sync_.rwlock(res);
+    auto reader = std::find(l.readers.begin(), l.readers.end(), idx);
+    if (l.writerIdx == idx) {
+        l.writerIdx = -1;
+    } else if (reader != l.readers.end()) {
+        l.settle(cycle_);
+        *reader = l.readers.back();
+        l.readers.pop_back();
+    } else {
+        std::cerr << "[Error] Ciclo " << cycle_ << ": Proceso " << wl_->pid(idx)
+                  << " intenta RELEASE(\"" << sync_.name(res)
+                  << "\") sin haber hecho READ ni WRITE.\n";
+        return;
+    }
+    syncLog_.push_back({ cycle_, idx, res, SyncResult::ACCESSED, SyncAction::RELEASE });
+    waitFor_.removeHolder(res, idx);
+
+    // A quién le toca según la política: un escritor necesita el lock vacío;
+    // los lectores entran todos juntos
+    if (l.writerIdx >= 0) return;
+    bool writerFirst;
+    switch (l.policy) {
+        case RwPolicy::READERS: writerFirst = l.readQueue.empty();  break;
+        case RwPolicy::WRITERS: writerFirst = !l.writeQueue.empty(); break;
+        default:
+            writerFirst = !l.writeQueue.empty() &&
+                          (l.readQueue.empty() ||
+                           l.writeQueue.front().turn < l.readQueue.front().turn);
+            break;
+    }
+    if (writerFirst) {
+        if (l.writeQueue.empty() || !l.readers.empty()) return;
+        RwLock::Waiter w = l.writeQueue.front();
+        l.writeQueue.pop_front();
+        rwWake(w, res, true);
+        return;
+    }
+    // en FAIR sólo los lectores que llegaron antes que el primer escritor
+    const unsigned limit = l.policy == RwPolicy::FAIR && !l.writeQueue.empty()
+                         ? l.writeQueue.front().turn : UINT_MAX;
+    while (!l.readQueue.empty() && l.readQueue.front().turn < limit) {
+        RwLock::Waiter w = l.readQueue.front();
+        l.readQueue.pop_front();
+        rwWake(w, res, false);
+    }
+}
 
-            // Si no hay nadie más prioritario, continuar el actual
-        }
-        break;
-
-        // Algoritmo Round Robin
-        case SchedulingAlgo::RR:
-        {
-            if (runningIdx_ >= 0 && rrCounter_ >= rrQuantum_) {
-                readyQueue_.push_back(runningIdx_);
-                runningIdx_ = -1;
-                rrCounter_ = 0;
-            }
+void SimulationEngine::rwWake(const RwLock::Waiter& w, int res, bool write) {
+    wake(w.idx);
+    waitFor_.wake(w.idx);
+    rwEnter(w.idx, res, write, w.since);
+}
 
-            if (runningIdx_ < 0 && !readyQueue_.empty()){
-                runningIdx_ = readyQueue_.front();
-                readyQueue_.pop_front();
-                rrCounter_ = 0;
-            }
-        }
-        break;
+// Entra al lock (ya comprobado que puede) habiendo pedido en `since`
+void SimulationEngine::rwEnter(int idx, int res, bool write, int since) {
+    RwLock& l = sync_.rwlock(res);
+    if (write) {
+        l.writerIdx = idx;
+        const int waited = cycle_ - since;
+        l.writes++;
+        l.writerWait   += waited;
+        l.maxWriterWait = std::max(l.maxWriterWait, waited);
+    } else {
+        l.settle(cycle_);
+        l.readers.push_back(idx);
+        l.maxReaders = std::max(l.maxReaders, (int)l.readers.size());
     }
+    waitFor_.addHolder(res, idx);
+    syncLog_.push_back({ cycle_, idx, res, SyncResult::ACCESSED,
+                         write ? SyncAction::WRITE : SyncAction::READ });
 }
 
-float SimulationEngine::getAverageWaitingTime() const {
-    float total = 0.0f;
-    int count = 0;
-    std::unordered_map<std::string, int> firstAppearance;
-
-    for (int i = 0; i < (int)executionHistory_.size(); ++i) {
-        const std::string& pid = executionHistory_[i];
-        if (pid == "idle") continue;
-        if (!firstAppearance.count(pid)) {
-            firstAppearance[pid] = i;
-        }
-    }
+// Queda fuera de la CPU y de las colas hasta que wake() le dé el recurso
+void SimulationEngine::block(int idx) {
+    live_.state[idx]        = ProcState::BLOCKED;
+    live_.blockedSince[idx] = cycle_;
+}
 
-    for (const auto& proc : procs_) {
-        if (firstAppearance.count(proc.pid) && proc.completionTime != -1) {
-            int wait = proc.completionTime - proc.arrival - proc.burst;
-            total += wait;
-            count++;
-        }
-    }
+// Recibió el recurso: vuelve a la política activa como cualquier llegada
+void SimulationEngine::wake(int idx) {
+    // en SYNCHRONIZATION puede seguir en otra cola y despertar dos veces
+    int32_t& since = live_.blockedSince[idx];
+    if (since >= 0) live_.lockWait[idx] += cycle_ - since;
+    since = -1;
+    live_.state[idx] = ProcState::READY;
+    (this->*ops_->enqueue)(idx);
+}
 
-    return count == 0 ? 0.0f : total / count;
+// Modo UNIFIED: dispara, en orden, las acciones de `idx` que ya le tocan
+// según lo que lleva ejecutado. false si quedó bloqueado; las que siguen
+// esperan a que vuelva a la CPU.
+bool SimulationEngine::fireActions(int idx) {
+    const int executed = wl_->burst[idx] - live_.remaining[idx];
+    const int end      = wl_->procActStart[idx + 1];
+    int32_t&  done     = live_.actsDone[idx];
+    for (int k = wl_->procActStart[idx] + done; k < end; ++k) {
+        const int a = wl_->procActs[k];
+        if (wl_->execOffset(a) > executed) break;
+        done++;
+        applySyncAction(wl_->acts[a]);
+        if (live_.state[idx] == ProcState::BLOCKED) return false;
+    }
+    return true;
 }
 
-void SimulationEngine::executeRunning() {
-    if (runningIdx_ < 0) return;
+// Ciclos que puede ejecutar `idx` antes de su próxima acción (UNIFIED)
+int SimulationEngine::cyclesToAction(int idx) const {
+    const int k = wl_->procActStart[idx] + live_.actsDone[idx];
+    if (k == wl_->procActStart[idx + 1]) return INT_MAX;
+    return wl_->execOffset(wl_->procActs[k]) - (wl_->burst[idx] - live_.remaining[idx]);
+}
 
-    auto& p = procs_[runningIdx_];
-    p.remaining--;
+// Con cada arista nueva sólo se mira lo alcanzable desde `proc`; cada
+// participante queda con un evento DEADLOCK sobre el recurso que espera
+void SimulationEngine::reportDeadlock(int proc) {
+    std::vector<WaitForGraph::Edge> edges;
+    auto pending = [this](int res, std::vector<int>& others) {
+        return pendingFree(res, others);
+    };
+    if (!waitFor_.findDeadlock(proc, pending, edges)) return;
+    for (const WaitForGraph::Edge& e : edges)
+        syncLog_.push_back({ cycle_, e.first, e.second,
+                             SyncResult::WAITING, SyncAction::DEADLOCK });
+}
 
-    if (algo_ == SchedulingAlgo::RR)
-        rrCounter_++;
+// Se perdió un SIGNAL sobre el semáforo `res`. Si ningún dueño corre y nadie
+// libre tiene otro pendiente, se revisan sus procesos en espera
+void SimulationEngine::reportLostSignal(int res) {
+    for (int q : waitFor_.holders(res))
+        if (!waitFor_.blocked(q)) return;
+    if (waitFor_.freeSignals(res) > 0) return;
+    for (const auto& w : sync_.semaphore(res).waitQueue)
+        if (!waitFor_.deadlocked(w.first)) reportDeadlock(w.first);
+}
 
-    if (p.remaining <= 0 && p.completionTime == -1) {
-        p.completionTime = cycle_ + 1;
-        runningIdx_ = -1;
-        rrCounter_ = 0;
+// Lo que la carga todavía puede hacer con `res` cuando nadie libre lo va a
+// devolver. Los SIGNAL pendientes de procesos bloqueados van a `others`: el
+// grafo exige que también estén trabados. En SYNCHRONIZATION un proceso
+// bloqueado sigue aplicando sus acciones salvo SIGNAL, así que un RELEASE
+// pendiente de un dueño lo libera igual; en UNIFIED un bloqueado no ejecuta
+// nada.
+bool SimulationEngine::pendingFree(int res, std::vector<int>& others) const {
+    const bool unified = mode_ == SimMode::UNIFIED;
+    if (sync_.kind(res) == ResourceKind::SEMAPHORE) {
+        auto first = wl_->resSignals.begin() + wl_->resSignalStart[res];
+        auto last  = wl_->resSignals.begin() + wl_->resSignalStart[res + 1];
+        if (!unified) first = std::upper_bound(first, last, curAct_);
+        for (; first != last; ++first) {
+            const int p = wl_->acts[*first].proc;
+            if (!unified || wl_->procActRank[*first] >= live_.actsDone[p])
+                others.push_back(p);
+        }
+        return false;
+    }
+    if (unified) return false;
+    for (int q : waitFor_.holders(res)) {
+        auto first = wl_->procActs.begin() + wl_->procActStart[q];
+        auto last  = wl_->procActs.begin() + wl_->procActStart[q + 1];
+        for (first = std::upper_bound(first, last, curAct_); first != last; ++first) {
+            const SyncOp& op = wl_->acts[*first];
+            if (op.res == res && op.type == SyncAction::RELEASE) return true;
+        }
     }
+    return false;
+}
+
+float SimulationEngine::getAverageWaitingTime() const {
+    return metrics_.avgWaiting();
 }
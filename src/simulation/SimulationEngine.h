@@ -4,11 +4,37 @@
 #include "Resource.h"
 #include "Action.h"
 #include "SyncPrimitives/SyncPrimitives.h"
+#include "SyncPrimitives/WaitForGraph.h"
 #include "common/SimMode.h"
-#include <unordered_map>
+#include "simulation/ReadyQueue.h"
+#include "simulation/ExecutionHistory.h"
+#include "simulation/Metrics.h"
+#include "simulation/CompiledWorkload.h"
+#include "simulation/ProcessTable.h"
+#include "simulation/SchedulingPolicy.h"
+#include "simulation/SyncTimeline.h"
+#include <cstdint>
+#include <memory>
+#include <string>
 #include <vector>
 #include <deque>
 
+// Reparto de procesos entre núcleos:
+//  - GLOBAL        → una sola cola de listos compartida por todos los núcleos
+//  - WORK_STEALING → una cola por núcleo; un núcleo ocioso roba del más cargado
+enum class CoreBalancing { GLOBAL, WORK_STEALING };
+
+inline const char* coreBalancingName(CoreBalancing b) {
+    return b == CoreBalancing::GLOBAL ? "global" : "work-stealing";
+}
+
+inline bool parseCoreBalancing(const std::string& name, CoreBalancing& out) {
+    for (CoreBalancing b : { CoreBalancing::GLOBAL, CoreBalancing::WORK_STEALING }) {
+        if (name == coreBalancingName(b)) { out = b; return true; }
+    }
+    return false;
+}
+
 class SimulationEngine {
 public:
     SimulationEngine(const std::vector<Process>& procs,
@@ -16,77 +42,257 @@ public:
                      const std::vector<Action>& acts,
                      SchedulingAlgo algo,
                      int rrQuantum = 1);
+    // Desde una carga binaria proyectada: las acciones se toman de las
+    // columnas ya resueltas y ordenadas
+    SimulationEngine(const BinaryWorkload& workload,
+                     SchedulingAlgo algo,
+                     int rrQuantum = 1);
+    // Sobre un workload ya compilado (compartido, no se copia)
+    SimulationEngine(std::shared_ptr<const CompiledWorkload> workload,
+                     SchedulingAlgo algo,
+                     int rrQuantum = 1);
+
+    // Copia independiente del estado actual. Las entradas se comparten, así
+    // que cuesta sólo el estado vivo (procesos, cola, recursos, historial).
+    SimulationEngine fork() const { return *this; }
+    const std::shared_ptr<const CompiledWorkload>& workload() const { return wl_; }
 
     void reset();
-    void tick();
+    void tick() { (this->*ops_->tick)(); }
+
+    // Número de núcleos simulados y cómo se reparten los procesos; reinicia
+    // la simulación. Con un núcleo ambos modos equivalen al motor original.
+    void setCores(int cores, CoreBalancing balancing = CoreBalancing::GLOBAL);
+    int           coreCount() const { return (int)running_.size(); }
+    CoreBalancing balancing() const { return balancing_; }
+
+    // Modo por eventos discretos: salta los ciclos en los que sólo se
+    // decrementa `remaining` (o no pasa nada) y procesa con tick() el
+    // siguiente ciclo con llegada, finalización, fin de quantum o acción.
+    // Produce el mismo historial, completionTime y syncLog_ que tick().
+    void advanceToNextEvent() { (this->*ops_->advance)(); }
+    // Avanza hasta que currentCycle() == cycle o la simulación termine.
+    void runUntil(int cycle) { (this->*ops_->runUntil)(cycle); }
     bool isFinished() const;
     int  currentCycle() const;
-    int  runningIndex() const;
+    int  runningIndex(int core = 0) const { return running_[core]; }
     const std::vector<Process>&  procs() const;
-    const std::deque<int>&       readyQueue() const;
+    // Cola de la que toma procesos `core` (la compartida en modo GLOBAL)
+    const ReadyQueue&            readyQueue(int core = 0) const;
+    size_t                       readyCount() const { return queuedCount_; }
 
-    const std::vector<std::string>& getExecutionHistory() const {
-        return executionHistory_;
-    }
-    void setAlgorithm(SchedulingAlgo algo) {
-        algo_ = algo;
+    // Historial por tramos (proceso, ciclo inicial, duración) de cada núcleo
+    const ExecutionHistory& getExecutionHistory(int core = 0) const {
+        return histories_[core];
     }
+    // Elige la política una sola vez: tick(), runUntil() y
+    // advanceToNextEvent() pasan a la versión del ciclo instanciada para ella.
+    // Como antes, no reinicia la simulación (la cola conserva su orden).
+    void setAlgorithm(SchedulingAlgo algo);
     SchedulingAlgo getAlgorithm() const {
         return algo_;
     }
+    // Política propia (ver SchedulingPolicy.h), sin pasar por SchedulingAlgo;
+    // getAlgorithm() conserva el último algoritmo incorporado elegido
+    template <class P> void setPolicy() { ops_ = &opsFor<P>(); }
+    const char* policyName() const { return ops_->name; }
 
     float getAverageWaitingTime() const;
 
+    // Métricas incrementales (válidas también a mitad de la simulación)
+    const Metrics& metrics() const { return metrics_; }
+    const std::vector<ProcessMetrics>& processMetrics() const { return procMetrics_; }
+
     int rrQuantum_   = 1;
+    // MLFQ: cada cuántos ciclos todos vuelven al nivel 0 (<= 0 desactiva)
+    int mlfqBoostPeriod_ = 100;
+    static constexpr int MLFQ_LEVELS = MlfqPolicy::LEVELS;
 
     const std::vector<SyncEvent>& getSyncLog() const { return syncLog_; }
+    // El syncLog indexado por tipo de recurso y ciclo
+    const SyncTimeline&           syncTimeline() const { return syncTimeline_; }
 
     void setMode(SimMode m) { mode_ = m; }
     SimMode getMode() const   { return mode_; }
 
-    bool isMutex(const std::string& name) const;
+    // Checkpoints para moverse por la línea de tiempo: cada `k` ciclos se
+    // guarda el estado mutable y seekTo() restaura el más cercano anterior
+    // al ciclo pedido, re-simulando sólo lo que falta (k <= 0 desactiva).
+    // Se descartan si cambian el algoritmo, el quantum o el modo. Se guardan
+    // a lo sumo MAX_CHECKPOINTS: al llegar al tope se descarta uno de cada dos
+    // y el intervalo efectivo (checkpointStride) se duplica.
+    static constexpr size_t MAX_CHECKPOINTS = 32;
+    void   setCheckpointInterval(int k);
+    int    checkpointInterval() const { return checkpointInterval_; }
+    int    checkpointStride() const   { return checkpointStride_; }
+    size_t checkpointCount() const    { return checkpoints_.size(); }
+    void   seekTo(int cycle);
 
-    const std::unordered_map<std::string, Mutex>& getMutexes() const {
-        return sync_.mutexes;
-    }
-    const std::unordered_map<std::string, Semaphore>& getSemaphores() const {
-        return sync_.semaphores;
-    }
+    // Recursos por id (posición en resources.txt)
+    int  resourceCount() const { return (int)wl_->resources.names.size(); }
+    const std::string& resourceName(int res) const { return sync_.name(res); }
+    bool isMutex(int res) const { return sync_.isMutex(res); }
+    ResourceKind resourceKind(int res) const { return sync_.kind(res); }
+    const RwLock&    getRwLock(int res)    const { return sync_.rwlock(res); }
+    const Mutex&     getMutex(int res)     const { return sync_.mutex(res); }
+    const Semaphore& getSemaphore(int res) const { return sync_.semaphore(res); }
+    const SyncPrimitives& syncState() const { return sync_; }
 
 private:
 
+    // Ciclo interno instanciado para una política; se elige al configurar
+    struct PolicyOps {
+        const char*        name;
+        ReadyQueue::Order  order;
+        void (SimulationEngine::*tick)();
+        void (SimulationEngine::*advance)();
+        void (SimulationEngine::*runUntil)(int);
+        void (SimulationEngine::*enqueue)(int);
+    };
+    template <class P> static const PolicyOps& opsFor();
+    const PolicyOps* ops_ = nullptr;
+
     SimMode mode_ = SimMode::SCHEDULING;
 
-    // datos originales (para reset)
-    std::vector<Process>  origProcs_;
-    std::vector<Resource> origRes_;
-    std::vector<Action>   origActs_;
+    // entradas compiladas, inmutables y compartidas entre copias
+    std::shared_ptr<const CompiledWorkload> wl_;
+
+    // Estado vivo de los procesos en columnas; pid, burst, arrival y
+    // priority se leen de las columnas del workload
+    ProcessTable live_;
+
+    // Vista de compatibilidad para procs(): se arma al pedirla y se reutiliza
+    // mientras el estado no cambie (version_ avanza con cada paso)
+    uint64_t version_ = 0;
+    mutable uint64_t viewVersion_ = UINT64_MAX;
+    mutable std::shared_ptr<const std::vector<Process>> procsView_;
 
     SyncPrimitives sync_;
     std::vector<SyncEvent> syncLog_; 
-    std::unordered_map<std::string, Mutex>    mutexes_;
-    std::unordered_map<std::string, Semaphore> semaphores_;
+    SyncTimeline           syncTimeline_;
+    WaitForGraph           waitFor_;
 
-    // estado mutable
-    std::vector<Process>  procs_;
-    std::vector<Resource> res_;
-    std::vector<Action>   acts_;
+    size_t nextBucket_ = 0;
+    int    curAct_     = -1;   // acción de acts que se está aplicando (SYNCHRONIZATION)
 
-    std::vector<std::string> executionHistory_;
+    Metrics                     metrics_;
+    std::vector<ProcessMetrics> procMetrics_;
 
     int cycle_       = 0;
     SchedulingAlgo algo_;
-    int rrCounter_   = 0;
+    CoreBalancing  balancing_ = CoreBalancing::GLOBAL;
 
-    int maxSyncCycle_; 
-    
-    std::deque<int> readyQueue_;
-    int runningIdx_  = -1;
+    // cursor sobre wl_->arrivalOrder
+    size_t nextArrivalPos_ = 0;
+    int    doneCount_      = 0;   // procesos con remaining <= 0
 
-    int findProcessIndex(const std::string& pid) const;
+    // Por núcleo: proceso en ejecución (-1 = ocioso), ciclos desde su
+    // despacho e historial. Hay una cola por núcleo en WORK_STEALING y una en
+    // GLOBAL.
+    std::vector<int>              running_ = std::vector<int>(1, -1);
+    std::vector<int>              slice_;
+    std::vector<ExecutionHistory> histories_;
+    std::vector<ReadyQueue>       queues_;
+    size_t                        queuedCount_ = 0;   // suma de todas las colas
+    std::vector<uint8_t>          coreChanged_;       // auxiliar de scheduleGroup
+
+    // CFS: piso de vruntime (máximo de los despachados); quien entra a una
+    // cola arranca desde aquí para no acaparar la CPU
+    long long minVruntime_ = 0;
+    // MLFQ: boosts ocurridos. Un nivel fijado en un boost anterior vale 0, así
+    // el boost no recorre procesos ni colas (ver MlfqPolicy)
+    int       boostEpoch_  = 0;
+
+    // Estado mutable en un ciclo; el historial y el syncLog sólo crecen, así
+    // que basta con recordar su largo
+    struct Checkpoint {
+        int                         cycle;
+        ProcessTable                live;
+        std::vector<Mutex>          mutexes;
+        std::vector<Semaphore>      semaphores;
+        std::vector<RwLock>         rwlocks;
+        WaitForGraph                waitFor;
+        std::vector<ReadyQueue>     queues;
+        Metrics                     metrics;
+        std::vector<ProcessMetrics> procMetrics;
+        size_t nextBucket;
+        size_t nextArrivalPos;
+        size_t syncLogSize;
+        size_t queuedCount;
+        long long minVruntime;
+        int    boostEpoch;
+        int    historyCycles;
+        int    doneCount;
+        std::vector<int> slice;
+        std::vector<int> running;
+    };
+    struct CheckpointKey {
+        const PolicyOps* policy;
+        int            quantum;
+        SimMode        mode;
+        int            cores;
+        CoreBalancing  balancing;
+        int            boostPeriod;
+        bool operator==(const CheckpointKey& o) const {
+            return policy == o.policy && quantum == o.quantum && mode == o.mode &&
+                   cores == o.cores && balancing == o.balancing &&
+                   boostPeriod == o.boostPeriod;
+        }
+    };
+    // ordenados por ciclo; inmutables, así que un fork comparte los anteriores
+    std::vector<std::shared_ptr<const Checkpoint>> checkpoints_;
+    CheckpointKey           checkpointKey_{};
+    int                     checkpointInterval_ = 0;
+    int                     checkpointStride_   = 0;   // intervalo efectivo
+
+    CheckpointKey currentKey() const {
+        return { ops_, rrQuantum_, mode_, coreCount(), balancing_, mlfqBoostPeriod_ };
+    }
+    void validateCheckpoints();
+    void maybeCheckpoint();
+    void restore(const Checkpoint& cp);
+
+    SchedContext context() {
+        return { *wl_, live_, slice_, minVruntime_, boostEpoch_,
+                 rrQuantum_, mlfqBoostPeriod_, cycle_ };
+    }
+    void pushReady(int q, int idx, long long key, long long seq = -1);
+    int  popReady(int q);
+    int  leastLoadedQueue() const;
+
+    // Piezas del ciclo, una instancia por política (SimulationEngineLoop.h)
+    template <class P> void tickImpl();
+    template <class P> void advanceImpl();
+    template <class P> void runUntilImpl(int cycle);
+    template <class P> void enqueueImpl(int idx);
+    template <class P> void handleArrivals();
+    template <class P> void scheduleNext();
+    template <class P> void scheduleGroup(int first, int last, int q);
+    template <class P> void steal(int core);
+    template <class P> void dispatch(int core, int idx);
+    template <class P> void executeRunning();
+    template <class P> int  quietCycles();
+    template <class P> void skipCycles(int k);
+    template <class P> void runActions();
 
-    void handleArrivals();
-    void scheduleNext();
-    void executeRunning();
     void handleSyncActions();
-};
\ No newline at end of file
+    bool applySyncAction(const SyncOp& act);
+    void indexSyncEvents(size_t from);
+    void block(int idx);
+    void wake(int idx);
+    bool fireActions(int idx);
+    int  cyclesToAction(int idx) const;
+    void reportDeadlock(int proc);
+    void reportLostSignal(int res);
+    bool pendingFree(int res, std::vector<int>& others) const;
+    void rwAcquire(int idx, int res, bool write);
+    void rwRelease(int idx, int res);
+    void rwWake(const RwLock::Waiter& w, int res, bool write);
+    void rwEnter(int idx, int res, bool write, int since);
+    const std::string& unknownResName(const SyncOp& op) const;
+
+    int  syncQuietCycles();
+    void recordCycles(int k);
+};
+
+#include "simulation/SimulationEngineLoop.h"
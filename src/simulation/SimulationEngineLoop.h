@@ -0,0 +1,295 @@
+#pragma once
+
+// Ciclo interno de SimulationEngine, instanciado por política. Se incluye al
+// final de SimulationEngine.h para que una política propia (setPolicy<P>())
+// también obtenga su instancia.
+
+#include <algorithm>
+#include <climits>
+
+template <class P>
+const SimulationEngine::PolicyOps& SimulationEngine::opsFor() {
+    static const PolicyOps ops{
+        P::name, P::order,
+        &SimulationEngine::tickImpl<P>,
+        &SimulationEngine::advanceImpl<P>,
+        &SimulationEngine::runUntilImpl<P>,
+        &SimulationEngine::enqueueImpl<P>,
+    };
+    return ops;
+}
+
+template <class P>
+void SimulationEngine::tickImpl() {
+
+    if (mode_ == SimMode::SYNCHRONIZATION && cycle_ >= wl_->maxSyncCycle) {
+        return;
+    }
+
+    cycle_++;
+    version_++;
+
+    if (mode_ != SimMode::SYNCHRONIZATION) {
+        SchedContext ctx = context();
+        P::beginTick(ctx);
+
+        // 1) arrivals
+        handleArrivals<P>();
+
+        // 2) scheduling (los no expropiativos sólo eligen en núcleos ociosos)
+        scheduleNext<P>();
+
+        // 3) UNIFIED: acciones de los que están en CPU antes de su ciclo
+        if (mode_ == SimMode::UNIFIED) runActions<P>();
+
+        // 4) record & execute
+        recordCycles(1);
+        executeRunning<P>();
+
+    } else {
+        // —————— MODO SYNCHRONIZATION ——————
+        handleSyncActions();
+    }
+
+    maybeCheckpoint();
+}
+
+template <class P>
+void SimulationEngine::advanceImpl() {
+    if (mode_ != SimMode::SYNCHRONIZATION && isFinished()) return;
+    skipCycles<P>(quietCycles<P>());
+    tickImpl<P>();
+}
+
+template <class P>
+void SimulationEngine::runUntilImpl(int cycle) {
+    while (cycle_ < cycle) {
+        if (mode_ != SimMode::SYNCHRONIZATION && isFinished()) break;
+        if (mode_ == SimMode::SYNCHRONIZATION && cycle_ >= wl_->maxSyncCycle) break;
+
+        // en long long: tras reset() cycle_ es -1 y cycle puede ser INT_MAX
+        const long long left = (long long)cycle - cycle_;
+        int k = std::min(quietCycles<P>(), (int)std::min<long long>(left, INT_MAX));
+        if (k > 0) skipCycles<P>(k);
+        else       tickImpl<P>();
+    }
+}
+
+// Un proceso que despierta entra a la cola menos cargada
+template <class P>
+void SimulationEngine::enqueueImpl(int idx) {
+    if (live_.queued[idx]) return;
+    SchedContext ctx = context();
+    P::admit(ctx, idx);
+    pushReady(leastLoadedQueue(), idx, P::key(ctx, idx));
+}
+
+template <class P>
+void SimulationEngine::handleArrivals() {
+    // Llegadas negativas entran en el primer ciclo
+    SchedContext ctx = context();
+    const auto& arrivals = wl_->arrivalOrder;
+    while (nextArrivalPos_ < arrivals.size()) {
+        int i = arrivals[nextArrivalPos_];
+        if (wl_->arrival[i] > cycle_) break;
+        nextArrivalPos_++;
+        P::admit(ctx, i);
+        pushReady(leastLoadedQueue(), i, P::key(ctx, i), P::tieByIndex ? i : -1);
+    }
+}
+
+// Pone `idx` a correr en `core`, contando la migración si antes corrió en otro
+template <class P>
+void SimulationEngine::dispatch(int core, int idx) {
+    running_[core] = idx;
+    slice_[core]   = 0;
+    int32_t& last = live_.lastCore[idx];
+    if (last >= 0 && last != core) metrics_.migrations++;
+    last = core;
+    SchedContext ctx = context();
+    P::onDispatch(ctx, core, idx);
+}
+
+template <class P>
+void SimulationEngine::scheduleNext() {
+    // GLOBAL: todos los núcleos sobre la cola compartida
+    if (balancing_ == CoreBalancing::GLOBAL) {
+        scheduleGroup<P>(0, coreCount(), 0);
+        return;
+    }
+
+    // Cada núcleo decide sobre su propia cola
+    for (int c = 0; c < coreCount(); ++c)
+        scheduleGroup<P>(c, c + 1, c);
+
+    for (int c = 0; c < coreCount() && queuedCount_ > 0; ++c)
+        if (running_[c] < 0) steal<P>(c);
+}
+
+// Núcleos [first, last) sobre la cola `q`. Primero los que agotaron su
+// quantum vuelven a la cola; los ociosos toman el tope en orden y, en las
+// políticas expropiativas, mientras el tope le gane al peor proceso en
+// ejecución (que pueda ser expropiado) lo reemplaza. Cada núcleo cambia a lo
+// sumo una vez por ciclo.
+template <class P>
+void SimulationEngine::scheduleGroup(int first, int last, int q) {
+    ReadyQueue&  queue = queues_[q];
+    SchedContext ctx   = context();
+
+    for (int c = first; c < last; ++c) {
+        const int idx = running_[c];
+        if (idx < 0 || !P::expire(ctx, c, idx)) continue;
+        pushReady(q, idx, P::key(ctx, idx));
+        running_[c] = -1;
+        slice_[c]   = 0;
+    }
+
+    for (int c = first; c < last; ++c) coreChanged_[c] = 0;
+    for (int c = first; c < last && !queue.empty(); ++c) {
+        if (running_[c] >= 0) continue;
+        dispatch<P>(c, popReady(q));
+        coreChanged_[c] = 1;
+    }
+
+    if constexpr (P::preemption != Preemption::NONE) {
+        while (!queue.empty()) {
+            int worst = -1;
+            long long worstKey = 0;
+            for (int c = first; c < last; ++c) {
+                const int idx = running_[c];
+                if (idx < 0 || coreChanged_[c] || !P::preemptible(ctx, c, idx)) continue;
+                long long key = P::runningKey(ctx, idx);
+                if (worst < 0 || key > worstKey) { worst = c; worstKey = key; }
+            }
+            if (worst < 0) break;
+
+            long long top = P::effectiveKey(ctx, queue.topKey());
+            bool preempt = P::preemption == Preemption::ON_TIE ? top <= worstKey
+                                                               : top <  worstKey;
+            if (!preempt) break;
+
+            const int prev = running_[worst];
+            int chosen = popReady(q);
+            pushReady(q, prev, P::key(ctx, prev));
+            dispatch<P>(worst, chosen);
+            coreChanged_[worst] = 1;
+        }
+    }
+}
+
+// Un núcleo ocioso se lleva el siguiente proceso de la cola más larga
+template <class P>
+void SimulationEngine::steal(int core) {
+    int victim = -1;
+    for (int q = 0; q < (int)queues_.size(); ++q) {
+        if (queues_[q].empty()) continue;
+        if (victim < 0 || queues_[q].size() > queues_[victim].size()) victim = q;
+    }
+    if (victim < 0) return;
+
+    dispatch<P>(core, popReady(victim));
+}
+
+template <class P>
+void SimulationEngine::executeRunning() {
+    SchedContext ctx = context();
+    for (int c = 0; c < coreCount(); ++c) {
+        const int i = running_[c];
+        if (i < 0) continue;
+
+        int32_t& remaining = live_.remaining[i];
+        if (remaining == 1) doneCount_++;
+        remaining--;
+        slice_[c]++;
+        P::onRun(ctx, i, 1);
+
+        if (remaining <= 0 && live_.completion[i] == -1) {
+            live_.completion[i] = cycle_ + 1;
+
+            ProcessMetrics& pm = procMetrics_[i];
+            pm.completion = live_.completion[i];
+            pm.turnaround = pm.completion - wl_->arrival[i];
+            pm.waiting    = pm.turnaround - wl_->burst[i];
+            pm.lockWait   = live_.lockWait[i];
+            pm.readyWait  = pm.waiting - pm.lockWait;
+            metrics_.onCompletion(pm);
+
+            running_[c] = -1;
+            slice_[c]   = 0;
+        }
+    }
+}
+
+// Número de ticks siguientes que no pueden cambiar nada salvo avanzar
+// el ciclo y decrementar `remaining` del proceso en ejecución.
+template <class P>
+int SimulationEngine::quietCycles() {
+    if (mode_ == SimMode::SYNCHRONIZATION) return syncQuietCycles();
+
+    if (isFinished()) return 0;
+
+    // handleArrivals ya admitió todo lo que llega hasta cycle_
+    const SchedContext ctx = context();
+    int limit = P::nextEvent(ctx);
+    const auto& arrivals = wl_->arrivalOrder;
+    if (nextArrivalPos_ < arrivals.size())
+        limit = std::min(limit, wl_->arrival[arrivals[nextArrivalPos_]] - cycle_ - 1);
+
+    for (int c = 0; c < coreCount(); ++c) {
+        const int idx = running_[c];
+        if (idx >= 0) {
+            // el tick en que termina lo procesa tick()
+            limit = std::min(limit, live_.remaining[idx] - 1);
+            limit = std::min(limit, P::quietLimit(ctx, c, idx, readyQueue(c)));
+            // ni el tick en que le toca una acción
+            if (mode_ == SimMode::UNIFIED) limit = std::min(limit, cyclesToAction(idx));
+        } else if (queuedCount_ > 0) {
+            // núcleo ocioso con alguien listo para entrar (o para robar)
+            return 0;
+        }
+    }
+    // nada en ejecución ni por llegar
+    if (limit == INT_MAX) return 0;
+    return std::max(0, limit);
+}
+
+// Modo UNIFIED: cada proceso en CPU dispara lo que le toca antes de ejecutar
+// su ciclo. Si alguno se bloquea o despierta a otro se vuelve a calendarizar
+// en este mismo ciclo (el despertado ya puede ocupar un núcleo o expropiar),
+// hasta que no cambie nada: cada vuelta consume al menos una acción.
+template <class P>
+void SimulationEngine::runActions() {
+    const size_t logStart = syncLog_.size();
+    for (bool changed = true; changed; ) {
+        const size_t queued = queuedCount_;
+        changed = false;
+        for (int c = 0; c < coreCount(); ++c) {
+            const int idx = running_[c];
+            if (idx < 0 || fireActions(idx)) continue;
+            running_[c] = -1;
+            slice_[c]   = 0;
+            changed     = true;
+        }
+        changed |= queuedCount_ != queued;
+        if (changed) scheduleNext<P>();
+    }
+    indexSyncEvents(logStart);
+}
+
+template <class P>
+void SimulationEngine::skipCycles(int k) {
+    if (k <= 0) return;
+    cycle_ += k;
+    version_++;
+    if (mode_ == SimMode::SYNCHRONIZATION) return;
+
+    recordCycles(k);
+    SchedContext ctx = context();
+    for (int c = 0; c < coreCount(); ++c) {
+        const int idx = running_[c];
+        if (idx < 0) continue;
+        live_.remaining[idx] -= k;
+        slice_[c] += k;
+        P::onRun(ctx, idx, k);
+    }
+}
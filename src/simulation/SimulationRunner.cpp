@@ -0,0 +1,248 @@
+#include "SimulationRunner.h"
+#include <algorithm>
+#include <climits>
+
+// Cada cuánto se publica como máximo mientras corre (más rápido que el vsync)
+static constexpr std::chrono::milliseconds PUBLISH_EVERY{4};
+// Ciclos por tanda a máxima velocidad, entre consulta y consulta del reloj
+static constexpr int FAST_BATCH = 4096;
+
+void SimView::apply(const SimSnapshot& s, const ResourceTable& table) {
+    snap_ = &s;
+
+    histories_.resize(s.historyTail.size());
+    for (size_t c = 0; c < histories_.size(); ++c) {
+        ExecutionHistory& h = histories_[c];
+        h.truncate(s.historyFrom);
+        for (const ExecSegment& seg : s.historyTail[c])
+            h.append(seg.procIdx, seg.length);
+    }
+
+    if (s.syncFrom < syncLog_.size()) {
+        syncLog_.erase(syncLog_.begin() + s.syncFrom, syncLog_.end());
+        timeline_.truncate(s.syncFrom);
+    }
+    for (const SyncEvent& ev : s.syncTail) {
+        if (ev.res >= 0)
+            timeline_.append((int)syncLog_.size(), ev.cycle, table.kinds[ev.res]);
+        syncLog_.push_back(ev);
+    }
+}
+
+SimulationRunner::SimulationRunner(SimulationEngine engine)
+  : engine_(std::move(engine))
+  , wl_(engine_.workload())
+{
+    publish();
+    thread_ = std::thread([this]{ loop(); });
+}
+
+SimulationRunner::~SimulationRunner() {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_one();
+    thread_.join();
+}
+
+void SimulationRunner::post(Command cmd) {
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        commands_.push_back(std::move(cmd));
+        pending_ = true;
+    }
+    cv_.notify_one();
+}
+
+// Todo pasa por la cola: el hilo despierta y publica el cambio
+void SimulationRunner::setRate(double cyclesPerSecond) {
+    post([this, cyclesPerSecond](SimulationEngine&) { rate_ = cyclesPerSecond; });
+}
+
+void SimulationRunner::play(bool on) {
+    post([this, on](SimulationEngine&) { playing_ = on; });
+}
+
+void SimulationRunner::step() {
+    post([](SimulationEngine& e) { e.tick(); });
+}
+
+void SimulationRunner::reset() {
+    post([this](SimulationEngine& e) {
+        e.reset();
+        playing_     = false;
+        timelineEnd_ = -1;
+    });
+}
+
+void SimulationRunner::seekTo(int cycle) {
+    post([this, cycle](SimulationEngine& e) {
+        e.seekTo(cycle);
+        playing_ = false;
+    });
+}
+
+void SimulationRunner::configure(Command change) {
+    post(std::move(change));
+}
+
+bool SimulationRunner::poll(SimView& view) {
+    if (!snapshots_.update()) return false;
+    const SimSnapshot& s = snapshots_.front();
+    view.apply(s, wl_->resources);
+
+    const uint64_t epoch = (uint64_t)s.epoch << 32;
+    ackHistory_.store(epoch | (uint32_t)view.history().cycles(), std::memory_order_release);
+    ackSync_.store(epoch | (uint32_t)view.syncLog().size(), std::memory_order_release);
+    return true;
+}
+
+bool SimulationRunner::done() const {
+    if (engine_.getMode() == SimMode::SYNCHRONIZATION)
+        return engine_.currentCycle() >= wl_->maxSyncCycle;
+    return engine_.isFinished();
+}
+
+// Una orden que recorta el historial o el syncLog (reset, seek hacia atrás,
+// cambio de núcleos) abre una época nueva: la próxima cola va desde cero
+void SimulationRunner::runCommands(std::vector<Command>& cmds) {
+    for (Command& cmd : cmds) {
+        const int    cycles = engine_.getExecutionHistory().cycles();
+        const size_t events = engine_.getSyncLog().size();
+        const int    cores  = engine_.coreCount();
+        cmd(engine_);
+        if (engine_.getExecutionHistory().cycles() < cycles ||
+            engine_.getSyncLog().size() < events ||
+            engine_.coreCount() != cores)
+            epoch_++;
+    }
+    cmds.clear();
+}
+
+// Simula lo que corresponde hasta ahora: todo lo posible durante un
+// intervalo de publicación, o los ciclos que vencieron al ritmo pedido
+void SimulationRunner::advance(Clock::time_point& next) {
+    const double rate = rate_;
+    const Clock::time_point now = Clock::now();
+    if (rate <= 0) {
+        const Clock::time_point until = now + PUBLISH_EVERY;
+        do engine_.runUntil(engine_.currentCycle() + FAST_BATCH);
+        while (!done() && !pending_ && Clock::now() < until);
+        next = Clock::now();
+        return;
+    }
+
+    const auto period = std::chrono::duration_cast<Clock::duration>(
+        std::chrono::duration<double>(1.0 / rate));
+    // tras una pausa o un ritmo más lento no se recupera el atraso
+    if (next + period < now) next = now;
+    if (next > now) return;
+    const auto due = (now - next) / period + 1;
+    next += due * period;
+    engine_.runUntil((int)std::min<long long>(INT_MAX - 1, engine_.currentCycle() + (long long)due));
+}
+
+void SimulationRunner::loop() {
+    std::vector<Command> cmds;
+    Clock::time_point    next        = Clock::now();
+    Clock::time_point    lastPublish = Clock::now();
+    bool                 dirty       = false;
+
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            auto woken = [&]{ return stop_ || !commands_.empty(); };
+            const bool active = playing_ && !done();
+            if (!active && !dirty)
+                cv_.wait(lock, woken);            // en pausa: hasta la próxima orden
+            else if (active && rate_ > 0)
+                cv_.wait_until(lock, dirty ? std::min(next, lastPublish + PUBLISH_EVERY)
+                                           : next, woken);
+            if (stop_) return;
+            cmds.swap(commands_);
+            pending_ = false;
+        }
+
+        if (!cmds.empty()) {
+            runCommands(cmds);
+            dirty = true;
+        }
+
+        if (playing_ && !done()) {
+            const int before = engine_.currentCycle();
+            advance(next);
+            if (engine_.currentCycle() != before) dirty = true;
+            if (done()) playing_ = false;
+        }
+
+        const Clock::time_point now = Clock::now();
+        if (dirty && (!playing_ || now - lastPublish >= PUBLISH_EVERY)) {
+            publish();
+            lastPublish = now;
+            dirty       = false;
+        }
+    }
+}
+
+void SimulationRunner::publish() {
+    SimSnapshot& s = snapshots_.back();
+    const SimulationEngine& e = engine_;
+    timelineEnd_ = std::max(timelineEnd_, e.currentCycle());
+
+    s.seq         = ++seq_;
+    s.cycle       = e.currentCycle();
+    s.finished    = done();
+    s.playing     = playing_;
+    s.timelineEnd = timelineEnd_;
+
+    s.mode        = e.getMode();
+    s.algo        = e.getAlgorithm();
+    s.quantum     = e.rrQuantum_;
+    s.boostPeriod = e.mlfqBoostPeriod_;
+    s.balancing   = e.balancing();
+
+    const int cores  = e.coreCount();
+    const int queues = e.balancing() == CoreBalancing::GLOBAL ? 1 : cores;
+    s.running.resize(cores);
+    for (int c = 0; c < cores; ++c) s.running[c] = e.runningIndex(c);
+    s.ready.resize(queues);
+    for (int q = 0; q < queues; ++q) {
+        s.ready[q].clear();
+        for (int idx : e.readyQueue(q)) {
+            if (s.ready[q].size() == READY_SHOWN) break;
+            s.ready[q].push_back(idx);
+        }
+    }
+    s.readyCount = e.readyCount();
+    s.metrics    = e.metrics();
+    s.mutexes    = e.syncState().mutexes;
+    s.semaphores = e.syncState().semaphores;
+    s.rwlocks    = e.syncState().rwlocks;
+
+    // Colas desde lo confirmado por el lector en esta época (desde cero si
+    // el último que leyó era de una época anterior)
+    s.epoch = epoch_;
+    const uint64_t ackH = ackHistory_.load(std::memory_order_acquire);
+    const uint64_t ackS = ackSync_.load(std::memory_order_acquire);
+    const int from = (ackH >> 32) == epoch_ ? (int)(uint32_t)ackH : 0;
+    s.historyFrom = std::min(from, e.getExecutionHistory().cycles());
+    s.historyTail.resize(cores);
+    for (int c = 0; c < cores; ++c) {
+        const ExecutionHistory& h = e.getExecutionHistory(c);
+        auto& tail = s.historyTail[c];
+        tail.clear();
+        for (size_t i = h.segmentAt(s.historyFrom); i < h.segments().size(); ++i) {
+            ExecSegment seg = h.segments()[i];
+            const int start = std::max(seg.start, s.historyFrom);
+            tail.push_back({ seg.procIdx, start, seg.end() - start });
+        }
+    }
+
+    const auto& log = e.getSyncLog();
+    const size_t syncFrom = (ackS >> 32) == epoch_ ? (size_t)(uint32_t)ackS : 0;
+    s.syncFrom = std::min(syncFrom, log.size());
+    s.syncTail.assign(log.begin() + s.syncFrom, log.end());
+
+    snapshots_.publish();
+}
@@ -0,0 +1,132 @@
+#pragma once
+
+#include "simulation/SimulationEngine.h"
+#include "simulation/SyncTimeline.h"
+#include "common/TripleBuffer.h"
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Estado publicado por el hilo de simulación. Lo que sólo crece (historial y
+// syncLog) viaja como la cola nueva a partir de lo que el lector ya confirmó.
+struct SimSnapshot {
+    uint64_t seq         = 0;
+    int      cycle       = -1;
+    bool     finished    = false;
+    bool     playing     = false;
+    int      timelineEnd = -1;    // ciclo más lejano simulado desde el último reinicio
+
+    // configuración con la que se simula
+    SimMode        mode        = SimMode::SCHEDULING;
+    SchedulingAlgo algo        = SchedulingAlgo::FIFO;
+    int            quantum     = 1;
+    int            boostPeriod = 0;
+    CoreBalancing  balancing   = CoreBalancing::GLOBAL;
+
+    std::vector<int>              running;      // por núcleo
+    std::vector<std::vector<int>> ready;        // por cola, hasta READY_SHOWN
+    size_t                        readyCount = 0;
+    Metrics                       metrics;
+    std::vector<Mutex>            mutexes;      // por ResourceTable::slots
+    std::vector<Semaphore>        semaphores;
+    std::vector<RwLock>           rwlocks;
+
+    uint32_t epoch       = 0;     // cambia cada vez que el historial se recorta
+    int      historyFrom = 0;     // la cola reemplaza lo registrado desde este ciclo
+    std::vector<std::vector<ExecSegment>> historyTail;   // por núcleo
+    size_t                 syncFrom = 0;
+    std::vector<SyncEvent> syncTail;
+};
+
+// Lo que ve el lector: la última instantánea más el historial, el syncLog y
+// su índice reconstruidos a partir de las colas
+class SimView {
+public:
+    bool               ready() const { return snap_ != nullptr; }
+    const SimSnapshot& state() const { return *snap_; }
+
+    int coreCount() const { return (int)histories_.size(); }
+    const ExecutionHistory&       history(int core = 0) const { return histories_[core]; }
+    const std::vector<SyncEvent>& syncLog()  const { return syncLog_; }
+    const SyncTimeline&           syncTimeline() const { return timeline_; }
+
+    void apply(const SimSnapshot& s, const ResourceTable& table);
+
+private:
+    const SimSnapshot*            snap_ = nullptr;   // ranura del lector en el TripleBuffer
+    std::vector<ExecutionHistory> histories_;
+    std::vector<SyncEvent>        syncLog_;
+    SyncTimeline                  timeline_;
+};
+
+// Corre un SimulationEngine en su propio hilo, al ritmo pedido, y publica
+// instantáneas inmutables por un TripleBuffer. Dibujar nunca frena la
+// simulación ni la simulación espera al vsync. Las órdenes de la interfaz
+// (play, step, seek, cambios de configuración) se aplican en el hilo de
+// simulación entre un ciclo y otro.
+class SimulationRunner {
+public:
+    static constexpr size_t READY_SHOWN = 256;
+
+    explicit SimulationRunner(SimulationEngine engine);
+    ~SimulationRunner();
+
+    SimulationRunner(const SimulationRunner&)            = delete;
+    SimulationRunner& operator=(const SimulationRunner&) = delete;
+
+    // Ciclos por segundo mientras corre; <= 0 → lo más rápido posible
+    void setRate(double cyclesPerSecond);
+    void play(bool on);
+    void step();
+    void reset();
+    void seekTo(int cycle);
+    // Cualquier otro cambio sobre el motor (algoritmo, quantum, núcleos...)
+    void configure(std::function<void(SimulationEngine&)> change);
+
+    // Hilo de la interfaz: aplica a `view` lo último publicado; false si no
+    // había nada nuevo
+    bool poll(SimView& view);
+
+    // Entradas compiladas (inmutables; se pueden leer desde cualquier hilo)
+    const std::shared_ptr<const CompiledWorkload>& workload() const { return wl_; }
+
+private:
+    using Clock   = std::chrono::steady_clock;
+    using Command = std::function<void(SimulationEngine&)>;
+
+    void post(Command cmd);
+    void loop();
+    void runCommands(std::vector<Command>& cmds);
+    void advance(Clock::time_point& next);
+    bool done() const;
+    void publish();
+
+    // sólo lo toca el hilo de simulación
+    SimulationEngine                        engine_;
+    std::shared_ptr<const CompiledWorkload> wl_;
+    uint32_t                                epoch_       = 0;
+    uint64_t                                seq_         = 0;
+    int                                     timelineEnd_ = -1;
+    bool                                    playing_     = false;
+    double                                  rate_        = 10.0;
+
+    std::mutex              mutex_;
+    std::condition_variable cv_;
+    std::vector<Command>    commands_;          // bajo mutex_
+    bool                    stop_ = false;      // bajo mutex_
+    std::atomic<bool>       pending_{false};    // hay órdenes en commands_
+
+    TripleBuffer<SimSnapshot> snapshots_;
+    // Lo que el lector ya tiene: (epoch << 32) | ciclos del historial o
+    // eventos del syncLog
+    std::atomic<uint64_t>     ackHistory_{0};
+    std::atomic<uint64_t>     ackSync_{0};
+
+    std::thread thread_;   // último: arranca con todo lo anterior listo
+};
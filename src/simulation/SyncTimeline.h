@@ -0,0 +1,63 @@
+#pragma once
+
+#include "SyncPrimitives/SyncPrimitives.h"
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+// Índice del syncLog por tipo de recurso y ciclo, para dibujar sólo lo que
+// cae en una ventana de ciclos sin recorrer el log entero. El tipo (mutex,
+// semáforo o RW lock) se resuelve una vez, al registrar cada evento.
+class SyncTimeline {
+public:
+    // Posiciones en el syncLog, en orden (por ciclo y, dentro de él, por
+    // proceso)
+    struct Span {
+        const int* first;
+        const int* last;
+        const int* begin() const { return first; }
+        const int* end()   const { return last; }
+        size_t     size()  const { return (size_t)(last - first); }
+        bool       empty() const { return first == last; }
+    };
+
+    void clear() {
+        for (Column& c : cols_) { c.events.clear(); c.cycles.clear(); }
+    }
+
+    // El evento en la posición `pos` del log; los ciclos llegan en orden
+    void append(int pos, int cycle, ResourceKind kind) {
+        Column& c = cols_[(int)kind];
+        c.events.push_back(pos);
+        c.cycles.push_back(cycle);
+    }
+
+    // Descarta lo que queda desde la posición `logSize` del log
+    void truncate(size_t logSize) {
+        for (Column& c : cols_) {
+            while (!c.events.empty() && (size_t)c.events.back() >= logSize) {
+                c.events.pop_back();
+                c.cycles.pop_back();
+            }
+        }
+    }
+
+    // Eventos de `kind` con ciclo en [from, to), por búsqueda binaria: la
+    // memoria crece con los eventos, no con el rango de ciclos
+    Span events(ResourceKind kind, int from, int to) const {
+        const Column& c = cols_[(int)kind];
+        const auto first = std::lower_bound(c.cycles.begin(), c.cycles.end(), from);
+        const auto last  = std::lower_bound(first, c.cycles.end(), std::max(from, to));
+        const int* base = c.events.data();
+        return { base + (first - c.cycles.begin()), base + (last - c.cycles.begin()) };
+    }
+
+    size_t count(ResourceKind kind) const { return cols_[(int)kind].events.size(); }
+
+private:
+    struct Column {
+        std::vector<int> events;     // posiciones en el log
+        std::vector<int> cycles;     // ciclo de cada evento (no decreciente)
+    };
+    Column cols_[RESOURCE_KIND_COUNT];
+};
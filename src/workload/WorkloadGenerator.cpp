@@ -0,0 +1,189 @@
+#include "WorkloadGenerator.h"
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+// splitmix64: rápido, con buena dispersión y definido bit a bit
+class Rng {
+public:
+    explicit Rng(uint64_t seed) : state_(seed) {}
+
+    uint64_t next() {
+        uint64_t z = (state_ += 0x9E3779B97F4A7C15ull);
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+        return z ^ (z >> 31);
+    }
+
+    // uniforme en [0, 1)
+    double uniform() { return (next() >> 11) * 0x1.0p-53; }
+
+    // entero uniforme en [lo, hi]
+    int range(int lo, int hi) {
+        return lo + (int)(uniform() * (double)(hi - lo + 1));
+    }
+
+    double exponential(double mean) { return -std::log(1.0 - uniform()) * mean; }
+
+    // Poisson por el método de Knuth (medias pequeñas: secciones por proceso)
+    int poisson(double mean) {
+        const double limit = std::exp(-mean);
+        int k = 0;
+        double p = uniform();
+        while (p > limit) { k++; p *= uniform(); }
+        return k;
+    }
+
+private:
+    uint64_t state_;
+};
+
+void validate(const WorkloadConfig& cfg) {
+    auto fail = [](const char* what) { throw std::invalid_argument(what); };
+    if (cfg.processes < 0)                 fail("processes debe ser >= 0");
+    if (cfg.arrivalRate <= 0)              fail("arrivalRate debe ser > 0");
+    if (cfg.maxBurst < 1)                  fail("maxBurst debe ser >= 1");
+    if (cfg.priorityWeights.empty())       fail("priorityWeights no puede estar vacío");
+    if (cfg.mutexes < 0 || cfg.semaphores < 0 || cfg.rwLocks < 0)
+                                           fail("cantidad de recursos negativa");
+    if (cfg.semaphoreMaxCount < 2)         fail("semaphoreMaxCount debe ser >= 2");
+    if (cfg.sectionsPerProcess < 0 || cfg.sectionsPerProcess > 50)
+                                           fail("sectionsPerProcess fuera de [0, 50]");
+    if (cfg.rwShare < 0 || cfg.rwShare > 1 || cfg.readShare < 0 || cfg.readShare > 1)
+                                           fail("rwShare y readShare deben estar en [0, 1]");
+    if (cfg.sectionsPerProcess > 0 && cfg.mutexes + cfg.semaphores + cfg.rwLocks == 0)
+                                           fail("hay secciones críticas pero ningún recurso");
+    for (double w : cfg.priorityWeights)
+        if (w < 0) fail("peso de prioridad negativo");
+}
+
+} // namespace
+
+FileSink::FileSink(const std::string& procPath,
+                   const std::string& resPath,
+                   const std::string& actPath)
+    : procs_(procPath), res_(resPath), acts_(actPath)
+{
+    if (!procs_.is_open()) throw std::runtime_error("No se pudo abrir " + procPath);
+    if (!res_.is_open())   throw std::runtime_error("No se pudo abrir " + resPath);
+    if (!acts_.is_open())  throw std::runtime_error("No se pudo abrir " + actPath);
+}
+
+void FileSink::resource(const Resource& r) {
+    res_ << r.name << ", ";
+    if (r.rwLock) res_ << rwPolicyName(r.rwPolicy) << '\n';
+    else          res_ << r.count << '\n';
+}
+
+void FileSink::process(const Process& p) {
+    procs_ << p.pid << ", " << p.burst << ", " << p.arrival << ", " << p.priority << '\n';
+}
+
+void FileSink::action(const Action& a) {
+    acts_ << a.pid << ", " << a.type << ", " << a.res << ", " << a.cycle << '\n';
+}
+
+void generateWorkload(const WorkloadConfig& cfg, WorkloadSink& sink) {
+    validate(cfg);
+    Rng rng(cfg.seed);
+
+    // Recursos: M1..Mn (capacidad 1), S1..Sn (capacidad >= 2) y RW1..RWn
+    std::vector<std::string> mutexNames, semNames, rwNames;
+    for (int i = 1; i <= cfg.mutexes; ++i) {
+        mutexNames.push_back("M" + std::to_string(i));
+        sink.resource({ mutexNames.back(), 1 });
+    }
+    for (int i = 1; i <= cfg.semaphores; ++i) {
+        semNames.push_back("S" + std::to_string(i));
+        sink.resource({ semNames.back(), rng.range(2, cfg.semaphoreMaxCount) });
+    }
+    for (int i = 1; i <= cfg.rwLocks; ++i) {
+        rwNames.push_back("RW" + std::to_string(i));
+        sink.resource({ rwNames.back(), 1, true, cfg.rwPolicy });
+    }
+
+    std::vector<double> priorityCdf;
+    double total = 0;
+    for (double w : cfg.priorityWeights) priorityCdf.push_back(total += w);
+
+    auto sampleBurst = [&]() {
+        double mean = cfg.burstMean;
+        if (cfg.burstDist == WorkloadConfig::BurstDist::BIMODAL)
+            mean = rng.uniform() < cfg.shortFraction ? cfg.shortBurstMean : cfg.longBurstMean;
+        double b = std::ceil(rng.exponential(mean));
+        return (int)std::min<double>(cfg.maxBurst, std::max(1.0, b));
+    };
+
+    auto samplePriority = [&]() {
+        if (total <= 0) return 0;
+        double u = rng.uniform() * total;
+        return (int)(std::upper_bound(priorityCdf.begin(), priorityCdf.end(), u)
+                     - priorityCdf.begin());
+    };
+
+    auto pickResource = [&](const std::vector<std::string>& names) -> const std::string& {
+        if (rng.uniform() < cfg.hotShare) return names.front();
+        return names[rng.range(0, (int)names.size() - 1)];
+    };
+
+    double clock = 0;
+    Process p;
+    Action  a;
+    for (int i = 1; i <= cfg.processes; ++i) {
+        // el primero llega en 0; luego huecos exponenciales de media 1/rate
+        if (i > 1) clock += rng.exponential(1.0 / cfg.arrivalRate);
+
+        p.pid      = "P" + std::to_string(i);
+        p.burst    = sampleBurst();
+        p.arrival  = (int)clock;
+        p.priority = samplePriority();
+        sink.process(p);
+        const int origin = cfg.execTime ? 0 : p.arrival;
+
+        // Secciones críticas: ADQUIRE/RELEASE, WAIT/SIGNAL o READ|WRITE/RELEASE
+        // dentro de su ráfaga. Sin RW locks no se sortea nada más, así las
+        // cargas de antes salen iguales.
+        int sections = rng.poisson(cfg.sectionsPerProcess);
+        for (int s = 0; s < sections; ++s) {
+            bool onRw = !rwNames.empty() &&
+                        ((mutexNames.empty() && semNames.empty()) || rng.uniform() < cfg.rwShare);
+            if (onRw) {
+                int start = origin + rng.range(0, p.burst - 1);
+                int hold  = 1 + (int)rng.exponential(cfg.holdMean);
+
+                a.pid   = p.pid;
+                a.res   = pickResource(rwNames);
+                a.kind  = rng.uniform() < cfg.readShare ? SyncAction::READ : SyncAction::WRITE;
+                a.type  = syncActionName(a.kind);
+                a.cycle = start;
+                sink.action(a);
+
+                a.kind  = SyncAction::RELEASE;
+                a.type  = syncActionName(a.kind);
+                a.cycle = start + hold;
+                sink.action(a);
+                continue;
+            }
+
+            bool onMutex = semNames.empty() ||
+                           (!mutexNames.empty() && rng.uniform() < cfg.mutexShare);
+            int start = origin + rng.range(0, p.burst - 1);
+            int hold  = 1 + (int)rng.exponential(cfg.holdMean);
+
+            a.pid = p.pid;
+            a.res = onMutex ? pickResource(mutexNames) : pickResource(semNames);
+
+            a.kind  = onMutex ? SyncAction::ADQUIRE : SyncAction::WAIT;
+            a.type  = syncActionName(a.kind);
+            a.cycle = start;
+            sink.action(a);
+
+            a.kind  = onMutex ? SyncAction::RELEASE : SyncAction::SIGNAL;
+            a.type  = syncActionName(a.kind);
+            a.cycle = start + hold;
+            sink.action(a);
+        }
+    }
+}
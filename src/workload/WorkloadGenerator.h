@@ -0,0 +1,94 @@
+#pragma once
+
+#include "Process.h"
+#include "Resource.h"
+#include "Action.h"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Parámetros de una carga sintética. Con la misma semilla y configuración se
+// obtiene exactamente la misma salida en cualquier plataforma (no se usan las
+// distribuciones de <random>, cuya implementación varía entre bibliotecas).
+struct WorkloadConfig {
+    enum class BurstDist { EXPONENTIAL, BIMODAL };
+
+    uint64_t seed      = 1;
+    int      processes = 1000;
+
+    // Llegadas de Poisson: tiempos entre llegadas exponenciales
+    double arrivalRate = 0.5;          // procesos por ciclo
+
+    BurstDist burstDist   = BurstDist::EXPONENTIAL;
+    double burstMean      = 8.0;       // EXPONENTIAL
+    double shortBurstMean = 3.0;       // BIMODAL: mezcla de dos exponenciales
+    double longBurstMean  = 40.0;
+    double shortFraction  = 0.8;
+    int    maxBurst       = 1000;
+
+    // peso relativo de cada prioridad (índice = prioridad)
+    std::vector<double> priorityWeights = { 1, 1, 1, 1, 1 };
+
+    // Recursos y contención
+    int    mutexes           = 2;
+    int    semaphores        = 2;
+    int    semaphoreMaxCount = 4;      // capacidad uniforme en [2, max]
+    double sectionsPerProcess = 1.0;   // secciones críticas por proceso (Poisson)
+    double mutexShare        = 0.5;    // fracción de secciones sobre mutex
+    double hotShare          = 0.0;    // fracción que va al primer recurso de su tipo
+    double holdMean          = 3.0;    // ciclos entre adquirir y liberar
+    // ciclos de las acciones contados desde que el proceso empieza a
+    // ejecutar (modo unified) en lugar de absolutos
+    bool   execTime          = false;
+
+    // RW locks: READ o WRITE y luego RELEASE
+    int      rwLocks   = 0;
+    RwPolicy rwPolicy  = RwPolicy::FAIR;
+    double   rwShare   = 0.5;          // fracción de secciones sobre RW locks
+    double   readShare = 0.8;          // de ésas, fracción de lecturas
+};
+
+// Destino de la generación; recibe los elementos a medida que se producen
+// (recursos primero, luego cada proceso seguido de sus acciones).
+class WorkloadSink {
+public:
+    virtual ~WorkloadSink() = default;
+    virtual void resource(const Resource& r) = 0;
+    virtual void process(const Process& p)   = 0;
+    virtual void action(const Action& a)     = 0;
+};
+
+// Acumula la carga en memoria, lista para SimulationEngine
+class VectorSink : public WorkloadSink {
+public:
+    std::vector<Process>  processes;
+    std::vector<Resource> resources;
+    std::vector<Action>   actions;
+
+    void resource(const Resource& r) override { resources.push_back(r); }
+    void process(const Process& p)   override { processes.push_back(p); }
+    void action(const Action& a)     override { actions.push_back(a); }
+};
+
+// Escribe directamente en los formatos de loadProcesses / loadResources /
+// loadActions sin retener la carga en memoria
+class FileSink : public WorkloadSink {
+public:
+    FileSink(const std::string& procPath,
+             const std::string& resPath,
+             const std::string& actPath);
+
+    void resource(const Resource& r) override;
+    void process(const Process& p)   override;
+    void action(const Action& a)     override;
+
+private:
+    std::ofstream procs_;
+    std::ofstream res_;
+    std::ofstream acts_;
+};
+
+// Genera la carga completa en `sink`. Lanza std::invalid_argument si la
+// configuración no tiene sentido.
+void generateWorkload(const WorkloadConfig& cfg, WorkloadSink& sink);
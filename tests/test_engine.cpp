@@ -0,0 +1,1138 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#include "simulation/SimulationEngine.h"
+#include "simulation/ReadyQueue.h"
+#include "simulation/ParameterSweep.h"
+#include "simulation/SimulationRunner.h"
+#include "common/WorkStealingPool.h"
+#include "workload/WorkloadGenerator.h"
+#include "Process.h"
+#include "Resource.h"
+#include "Action.h"
+
+#include <random>
+#include <atomic>
+#include <stdexcept>
+#include <climits>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+// Carga de trabajo pseudoaleatoria pero reproducible
+static void makeWorkload(unsigned seed,
+                         std::vector<Process>& procs,
+                         std::vector<Resource>& res,
+                         std::vector<Action>& acts) {
+    std::mt19937 rng(seed);
+    auto rnd = [&](int lo, int hi) {
+        return std::uniform_int_distribution<int>(lo, hi)(rng);
+    };
+
+    int n = rnd(1, 20);
+    for (int i = 0; i < n; ++i) {
+        Process p;
+        p.pid      = "P" + std::to_string(i);
+        p.burst    = rnd(1, 12);
+        p.arrival  = rnd(0, 30);
+        p.priority = rnd(0, 5);
+        procs.push_back(p);
+    }
+
+    res = { {"R0", 1}, {"R1", 2} };
+    const char* mutexOps[] = { "ADQUIRE", "RELEASE", "READ", "WRITE" };
+    const char* semOps[]   = { "WAIT", "SIGNAL", "READ", "WRITE" };
+    int nActs = rnd(0, 40);
+    for (int i = 0; i < nActs; ++i) {
+        bool onMutex = rnd(0, 1) == 0;
+        Action a;
+        a.pid   = "P" + std::to_string(rnd(0, n - 1));
+        a.type  = onMutex ? mutexOps[rnd(0, 3)] : semOps[rnd(0, 3)];
+        a.res   = onMutex ? "R0" : "R1";
+        a.cycle = rnd(0, 30);
+        parseSyncAction(a.type, a.kind);
+        acts.push_back(a);
+    }
+}
+
+static void requireSameRun(const SimulationEngine& a, const SimulationEngine& b) {
+    REQUIRE(a.currentCycle() == b.currentCycle());
+    REQUIRE(a.coreCount() == b.coreCount());
+    for (int c = 0; c < a.coreCount(); ++c)
+        REQUIRE(a.getExecutionHistory(c).segments() == b.getExecutionHistory(c).segments());
+    for (size_t i = 0; i < a.procs().size(); ++i)
+        CHECK(a.procs()[i].completionTime == b.procs()[i].completionTime);
+
+    auto const& la = a.getSyncLog();
+    auto const& lb = b.getSyncLog();
+    REQUIRE(la.size() == lb.size());
+    for (size_t i = 0; i < la.size(); ++i) {
+        CHECK(la[i].cycle  == lb[i].cycle);
+        CHECK(la[i].pidIdx == lb[i].pidIdx);
+        CHECK(la[i].res    == lb[i].res);
+        CHECK(la[i].action == lb[i].action);
+        CHECK(la[i].result == lb[i].result);
+    }
+}
+
+TEST_CASE("advanceToNextEvent reproduce la ejecución ciclo a ciclo", "[engine]") {
+    for (unsigned seed = 1; seed <= 50; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        for (int algo = 0; algo < SCHEDULING_ALGO_COUNT; ++algo) {
+            for (int q = 1; q <= 3; ++q) {
+                SimulationEngine byTick (procs, res, acts, static_cast<SchedulingAlgo>(algo), q);
+                SimulationEngine byEvent(procs, res, acts, static_cast<SchedulingAlgo>(algo), q);
+
+                while (!byTick.isFinished())  byTick.tick();
+                while (!byEvent.isFinished()) byEvent.advanceToNextEvent();
+
+                requireSameRun(byTick, byEvent);
+            }
+        }
+    }
+}
+
+TEST_CASE("runUntil se detiene en el ciclo pedido", "[engine]") {
+    std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+    makeWorkload(7, procs, res, acts);
+
+    SimulationEngine byTick (procs, res, acts, SchedulingAlgo::RR, 2);
+    SimulationEngine byEvent(procs, res, acts, SchedulingAlgo::RR, 2);
+
+    for (int i = 0; i < 11; ++i) byTick.tick();
+    byEvent.runUntil(10);
+    requireSameRun(byTick, byEvent);
+
+    // hasta INT_MAX desde el inicio, sin desbordar la distancia
+    SimulationEngine toMax(procs, res, acts, SchedulingAlgo::RR, 2);
+    SimulationEngine toEnd(procs, res, acts, SchedulingAlgo::RR, 2);
+    toMax.runUntil(INT_MAX);
+    toEnd.runUntil(INT_MAX - 1);
+    CHECK(toMax.isFinished());
+    requireSameRun(toMax, toEnd);
+}
+
+TEST_CASE("Sincronización por eventos genera el mismo syncLog", "[engine][sync]") {
+    for (unsigned seed = 1; seed <= 50; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        SimulationEngine byTick (procs, res, acts, SchedulingAlgo::FIFO);
+        SimulationEngine byEvent(procs, res, acts, SchedulingAlgo::FIFO);
+        byTick.setMode(SimMode::SYNCHRONIZATION);
+        byEvent.setMode(SimMode::SYNCHRONIZATION);
+
+        for (int i = 0; i < 40; ++i) byTick.tick();
+        byEvent.runUntil(40);
+
+        requireSameRun(byTick, byEvent);
+    }
+}
+
+// Lo que devuelve el índice es lo mismo que filtrar el log completo
+static void requireTimelineMatchesLog(const SimulationEngine& e) {
+    const auto& log = e.getSyncLog();
+    const int   last = log.empty() ? 0 : log.back().cycle;
+    for (ResourceKind kind : { ResourceKind::MUTEX, ResourceKind::SEMAPHORE,
+                               ResourceKind::RWLOCK }) {
+        for (int from = -1; from <= last + 1; from += 3) {
+            for (int to : { from, from + 1, from + 4, last + 2 }) {
+                std::vector<int> expected;
+                for (int i = 0; i < (int)log.size(); ++i)
+                    if (log[i].cycle >= from && log[i].cycle < to &&
+                        e.resourceKind(log[i].res) == kind)
+                        expected.push_back(i);
+                auto span = e.syncTimeline().events(kind, from, to);
+                REQUIRE(std::vector<int>(span.begin(), span.end()) == expected);
+            }
+        }
+    }
+}
+
+TEST_CASE("El índice del syncLog por tipo y ciclo sigue al log", "[engine][sync]") {
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        SimulationEngine e(procs, res, acts, SchedulingAlgo::FIFO);
+        e.setMode(SimMode::SYNCHRONIZATION);
+        e.setCheckpointInterval(4);
+        e.runUntil(40);
+        requireTimelineMatchesLog(e);
+
+        // al volver atrás se recorta y al re-simular se completa igual
+        for (int target : { 17, 3, 0, 40 }) {
+            e.seekTo(target);
+            requireTimelineMatchesLog(e);
+        }
+    }
+}
+
+TEST_CASE("El índice del syncLog no depende del rango de ciclos", "[engine][sync]") {
+    // dos eventos muy separados: sólo se guardan ellos, no un hueco por ciclo
+    SyncTimeline t;
+    t.append(0, 0, ResourceKind::MUTEX);
+    t.append(1, 400000000, ResourceKind::MUTEX);
+    t.append(2, 400000000, ResourceKind::SEMAPHORE);
+    CHECK(t.events(ResourceKind::MUTEX, 0, INT_MAX).size() == 2);
+    CHECK(t.events(ResourceKind::MUTEX, 1, 400000000).empty());
+    CHECK(*t.events(ResourceKind::MUTEX, 1, 400000001).begin() == 1);
+    CHECK(t.events(ResourceKind::SEMAPHORE, 0, 400000000).empty());
+    CHECK(t.events(ResourceKind::MUTEX, 5, 2).empty());
+
+    t.truncate(1);
+    CHECK(t.count(ResourceKind::MUTEX) == 1);
+    CHECK(t.count(ResourceKind::SEMAPHORE) == 0);
+    CHECK(t.events(ResourceKind::MUTEX, 0, INT_MAX).size() == 1);
+}
+
+static Action syncAct(const char* pid, const char* type, const char* res, int cycle) {
+    Action a{ pid, type, res, cycle };
+    parseSyncAction(a.type, a.kind);
+    return a;
+}
+
+// (proceso, recurso) de los DEADLOCK de un ciclo, en orden del log
+static std::vector<std::pair<int, int>> deadlocksAt(const SimulationEngine& e, int cycle) {
+    std::vector<std::pair<int, int>> out;
+    for (const SyncEvent& ev : e.getSyncLog())
+        if (ev.action == SyncAction::DEADLOCK && ev.cycle == cycle)
+            out.push_back({ ev.pidIdx, ev.res });
+    return out;
+}
+
+TEST_CASE("Un ciclo de ADQUIRE se informa como DEADLOCK al cerrarse", "[engine][sync][deadlock]") {
+    std::vector<Process>  procs = { { "A", 5, 0, 0 }, { "B", 5, 0, 0 }, { "C", 5, 0, 0 } };
+    std::vector<Resource> res   = { { "M0", 1 }, { "M1", 1 } };
+    std::vector<Action>   acts  = {
+        syncAct("A", "ADQUIRE", "M0", 0), syncAct("B", "ADQUIRE", "M1", 0),
+        syncAct("A", "ADQUIRE", "M1", 1),   // espera a B, que todavía puede avanzar
+        syncAct("B", "ADQUIRE", "M0", 2),   // cierra el ciclo
+        syncAct("C", "ADQUIRE", "M0", 4),   // se suma a un interbloqueo ya informado
+    };
+    SimulationEngine e(procs, res, acts, SchedulingAlgo::FIFO);
+    e.setMode(SimMode::SYNCHRONIZATION);
+    e.setCheckpointInterval(2);
+    e.runUntil(6);
+
+    CHECK(deadlocksAt(e, 1).empty());
+    CHECK(deadlocksAt(e, 2) == std::vector<std::pair<int, int>>{ { 0, 1 }, { 1, 0 } });
+    CHECK(deadlocksAt(e, 4) == std::vector<std::pair<int, int>>{ { 2, 0 } });
+    // el evento queda justo después de la espera que lo provocó
+    const auto& log = e.getSyncLog();
+    auto it = std::find_if(log.begin(), log.end(),
+        [](const SyncEvent& ev){ return ev.action == SyncAction::DEADLOCK && ev.pidIdx == 1; });
+    REQUIRE(it != log.begin());
+    CHECK(std::prev(it)->action == SyncAction::ADQUIRE);
+    CHECK(std::prev(it)->result == SyncResult::WAITING);
+    requireTimelineMatchesLog(e);
+
+    // volver atrás y re-simular reconstruye el grafo igual
+    SimulationEngine fresh(procs, res, acts, SchedulingAlgo::FIFO);
+    fresh.setMode(SimMode::SYNCHRONIZATION);
+    fresh.runUntil(6);
+    for (int target : { 3, 1, 6 }) {
+        e.seekTo(target);
+        fresh.seekTo(target);
+        requireSameRun(e, fresh);
+    }
+}
+
+TEST_CASE("Un semáforo no está trabado mientras alguien pueda hacerle SIGNAL", "[engine][sync][deadlock]") {
+    // P0 se queda con las dos unidades y pide una tercera; la da P1, que no
+    // tiene ninguna
+    std::vector<Process>  procs = { { "P0", 8, 0, 0 }, { "P1", 8, 0, 0 } };
+    std::vector<Resource> res   = { { "S", 2 } };
+    std::vector<Action>   acts  = {
+        syncAct("P0", "WAIT", "S", 0), syncAct("P0", "WAIT", "S", 1),
+        syncAct("P0", "WAIT", "S", 2), syncAct("P1", "SIGNAL", "S", 4),
+    };
+    for (SimMode mode : { SimMode::SYNCHRONIZATION, SimMode::UNIFIED }) {
+        SimulationEngine e(procs, res, acts, SchedulingAlgo::FIFO);
+        e.setMode(mode);
+        e.runUntil(INT_MAX - 1);
+        const auto& log = e.getSyncLog();
+        CHECK(std::none_of(log.begin(), log.end(),
+            [](const SyncEvent& ev){ return ev.action == SyncAction::DEADLOCK; }));
+        CHECK(std::any_of(log.begin(), log.end(),
+            [](const SyncEvent& ev){ return ev.action == SyncAction::WAKE && ev.pidIdx == 0; }));
+        if (mode == SimMode::UNIFIED) CHECK(e.metrics().completed == 2);
+    }
+
+    // A y B tienen las unidades y esperan el mutex de C, que espera S: un
+    // nudo, salvo que D (sin unidades) todavía vaya a hacer SIGNAL
+    procs = { { "A", 5, 0, 0 }, { "B", 5, 0, 0 }, { "C", 5, 0, 0 }, { "D", 9, 0, 0 } };
+    res   = { { "M", 1 }, { "S", 2 } };
+    acts  = {
+        syncAct("C", "ADQUIRE", "M", 0),
+        syncAct("A", "WAIT", "S", 0), syncAct("B", "WAIT", "S", 0),
+        syncAct("C", "WAIT", "S", 1),
+        syncAct("A", "ADQUIRE", "M", 2), syncAct("B", "ADQUIRE", "M", 3),
+    };
+    SimulationEngine knot(procs, res, acts, SchedulingAlgo::FIFO);
+    knot.setMode(SimMode::SYNCHRONIZATION);
+    knot.runUntil(4);
+    CHECK(deadlocksAt(knot, 2).empty());
+    CHECK(deadlocksAt(knot, 3) == std::vector<std::pair<int, int>>{ { 0, 0 }, { 1, 0 }, { 2, 1 } });
+
+    acts.push_back(syncAct("D", "SIGNAL", "S", 6));
+    SimulationEngine ok(procs, res, acts, SchedulingAlgo::FIFO);
+    ok.setMode(SimMode::SYNCHRONIZATION);
+    ok.runUntil(8);
+    for (const SyncEvent& ev : ok.getSyncLog())
+        CHECK(ev.action != SyncAction::DEADLOCK);
+
+    // si D está bloqueado cuando le toca (por E, que sigue corriendo), su
+    // SIGNAL no ocurre: ahí sí
+    procs.push_back({ "E", 9, 0, 0 });
+    res.push_back({ "N", 1 });
+    acts.push_back(syncAct("E", "ADQUIRE", "N", 0));
+    acts.push_back(syncAct("D", "ADQUIRE", "N", 5));
+    SimulationEngine late(procs, res, acts, SchedulingAlgo::FIFO);
+    late.setMode(SimMode::SYNCHRONIZATION);
+    late.runUntil(8);
+    CHECK(deadlocksAt(late, 3).empty());
+    CHECK(deadlocksAt(late, 5).empty());
+    CHECK(deadlocksAt(late, 6) == std::vector<std::pair<int, int>>{ { 0, 0 }, { 1, 0 }, { 2, 1 } });
+}
+
+TEST_CASE("En modo sincronización un dueño bloqueado todavía suelta lo que tiene", "[engine][sync][deadlock]") {
+    std::vector<Process>  procs = { { "A", 5, 0, 0 }, { "B", 5, 0, 0 } };
+    std::vector<Resource> res   = { { "M0", 1 }, { "M1", 1 } };
+    std::vector<Action>   acts  = {
+        syncAct("A", "ADQUIRE", "M0", 0), syncAct("B", "ADQUIRE", "M1", 0),
+        syncAct("A", "ADQUIRE", "M1", 1),
+        syncAct("B", "ADQUIRE", "M0", 2),   // A está bloqueado, pero...
+        syncAct("A", "RELEASE", "M0", 3),   // ...su RELEASE se aplica igual
+    };
+    SimulationEngine e(procs, res, acts, SchedulingAlgo::FIFO);
+    e.setMode(SimMode::SYNCHRONIZATION);
+    e.runUntil(4);
+    for (const SyncEvent& ev : e.getSyncLog())
+        CHECK(ev.action != SyncAction::DEADLOCK);
+    CHECK(e.getMutex(0).ownerIdx == 1);
+}
+
+// Dueños de un RW lock tras correr hasta `cycle`: escritor y lectores (por índice)
+struct RwHolders { int writer; std::vector<int> readers; size_t waiting; };
+static RwHolders rwAt(const std::vector<Action>& acts, RwPolicy policy, int cycle,
+                      RwLock* out = nullptr) {
+    std::vector<Process> procs = { { "A", 9, 0, 0 }, { "B", 9, 0, 0 },
+                                   { "C", 9, 0, 0 }, { "D", 9, 0, 0 } };
+    std::vector<Resource> res = { { "L", 1, true, policy } };
+    SimulationEngine e(procs, res, acts, SchedulingAlgo::FIFO);
+    e.setMode(SimMode::SYNCHRONIZATION);
+    e.runUntil(cycle);
+    const RwLock& l = e.getRwLock(0);
+    if (out) *out = l;
+    std::vector<int> readers = l.readers;
+    std::sort(readers.begin(), readers.end());
+    return { l.writerIdx, readers, l.readQueue.size() + l.writeQueue.size() };
+}
+
+TEST_CASE("RW lock: los lectores comparten y la política decide quién sigue", "[engine][sync][rwlock]") {
+    // A y B leen a la vez; C quiere escribir; D llega a leer con C esperando
+    std::vector<Action> acts = {
+        syncAct("A", "READ", "L", 0), syncAct("B", "READ", "L", 0),
+        syncAct("C", "WRITE", "L", 1), syncAct("D", "READ", "L", 2),
+        syncAct("A", "RELEASE", "L", 3), syncAct("B", "RELEASE", "L", 4),
+    };
+    RwHolders r = rwAt(acts, RwPolicy::READERS, 4);
+    CHECK(r.writer == -1);
+    CHECK(r.readers == std::vector<int>{ 3 });     // D entró; C sigue esperando
+    CHECK(r.waiting == 1);
+    for (RwPolicy p : { RwPolicy::WRITERS, RwPolicy::FAIR }) {
+        RwLock l;
+        r = rwAt(acts, p, 4, &l);
+        CHECK(r.writer == 2);                      // C entró al irse B; D espera
+        CHECK(r.readers.empty());
+        CHECK(r.waiting == 1);
+        CHECK(l.maxReaders == 2);
+        CHECK(l.writes == 1);
+        CHECK(l.maxWriterWait == 3);
+        // dos lectores en [0,3) y uno en [3,4)
+        CHECK(l.avgReaders(4) == Approx(7.0 / 4));
+    }
+
+    // Con A escribiendo esperan B (lee), C (escribe) y D (lee)
+    acts = {
+        syncAct("A", "WRITE", "L", 0), syncAct("B", "READ", "L", 1),
+        syncAct("C", "WRITE", "L", 2), syncAct("D", "READ", "L", 3),
+        syncAct("A", "RELEASE", "L", 4),
+    };
+    CHECK(rwAt(acts, RwPolicy::READERS, 4).readers == std::vector<int>{ 1, 3 });
+    CHECK(rwAt(acts, RwPolicy::FAIR,    4).readers == std::vector<int>{ 1 });  // D llegó después de C
+    RwLock l;
+    r = rwAt(acts, RwPolicy::WRITERS, 4, &l);
+    CHECK(r.writer == 2);
+    CHECK(l.writes == 2);
+    CHECK(l.avgWriterWait() == Approx(1.0));       // A no esperó, C esperó 2
+}
+
+TEST_CASE("RW locks: por eventos y seekTo reproducen lo mismo", "[engine][sync][rwlock][checkpoint]") {
+    for (RwPolicy policy : { RwPolicy::READERS, RwPolicy::WRITERS, RwPolicy::FAIR }) {
+        WorkloadConfig cfg;
+        cfg.processes = 300;
+        cfg.arrivalRate = 2;
+        cfg.sectionsPerProcess = 2;
+        cfg.rwLocks = 3;
+        cfg.rwPolicy = policy;
+        cfg.hotShare = 0.5;
+        VectorSink w;
+        generateWorkload(cfg, w);
+
+        SimulationEngine byTick (w.processes, w.resources, w.actions, SchedulingAlgo::FIFO);
+        SimulationEngine byEvent(w.processes, w.resources, w.actions, SchedulingAlgo::FIFO);
+        byTick.setMode(SimMode::SYNCHRONIZATION);
+        byEvent.setMode(SimMode::SYNCHRONIZATION);
+        byEvent.setCheckpointInterval(16);
+        for (int i = 0; i < 200; ++i) byTick.tick();
+        byEvent.runUntil(199);
+        requireSameRun(byTick, byEvent);
+        requireTimelineMatchesLog(byEvent);
+        CHECK(byEvent.syncTimeline().count(ResourceKind::RWLOCK) > 0);
+
+        for (int target : { 120, 37, 199 }) {
+            SimulationEngine fresh(w.processes, w.resources, w.actions, SchedulingAlgo::FIFO);
+            fresh.setMode(SimMode::SYNCHRONIZATION);
+            fresh.runUntil(target);
+            byEvent.seekTo(target);
+            requireSameRun(byEvent, fresh);
+            for (int r = 0; r < (int)w.resources.size(); ++r) {
+                if (!w.resources[r].rwLock) continue;
+                CHECK(byEvent.getRwLock(r).readers    == fresh.getRwLock(r).readers);
+                CHECK(byEvent.getRwLock(r).writerWait == fresh.getRwLock(r).writerWait);
+                CHECK(byEvent.getRwLock(r).avgReaders(target) ==
+                      fresh.getRwLock(r).avgReaders(target));
+            }
+        }
+    }
+}
+
+TEST_CASE("ReadyQueue: heap indexado con decrease-key y remove", "[engine][queue]") {
+    ReadyQueue q;
+    q.reset(ReadyQueue::Order::MIN_KEY, 6);
+    q.push(0, 5);
+    q.push(1, 3);
+    q.push(2, 3);
+    q.push(3, 9);
+    q.push(4, 7);
+
+    CHECK(q.top() == 1);            // a igual clave, el primero encolado
+    q.updateKey(3, 1);              // decrease-key
+    CHECK(q.top() == 3);
+    CHECK(q.remove(1));
+    CHECK_FALSE(q.contains(1));
+    CHECK(q.size() == 4);
+
+    std::vector<int> order;
+    while (!q.empty()) order.push_back(q.pop());
+    CHECK(order == std::vector<int>{ 3, 2, 0, 4 });
+}
+
+TEST_CASE("ExecutionHistory agrupa ciclos consecutivos en tramos", "[engine][history]") {
+    ExecutionHistory h;
+    h.append(ExecutionHistory::IDLE, 2);
+    h.append(0);
+    h.append(0, 3);
+    h.append(1);
+
+    REQUIRE(h.segments().size() == 3);
+    CHECK(h.segments()[1] == ExecSegment{ 0, 2, 4 });
+    CHECK(h.cycles() == 7);
+    CHECK(h.procAt(1) == ExecutionHistory::IDLE);
+    CHECK(h.procAt(5) == 0);
+    CHECK(h.procAt(6) == 1);
+    CHECK(h.segmentAt(6) == 2);
+    CHECK(h.procAt(7) == ExecutionHistory::IDLE);
+}
+
+TEST_CASE("Las métricas incrementales coinciden con el historial", "[engine][metrics]") {
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        for (int algo = 0; algo < SCHEDULING_ALGO_COUNT; ++algo) {
+            SimulationEngine e(procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+            while (!e.isFinished()) e.advanceToNextEvent();
+
+            std::vector<int> firstRun(procs.size(), -1);
+            long long busy = 0, idle = 0;
+            for (const auto& seg : e.getExecutionHistory().segments()) {
+                if (seg.procIdx == ExecutionHistory::IDLE) { idle += seg.length; continue; }
+                busy += seg.length;
+                if (firstRun[seg.procIdx] < 0) firstRun[seg.procIdx] = seg.start;
+            }
+
+            const Metrics& m = e.metrics();
+            CHECK(m.busyCycles == busy);
+            CHECK(m.idleCycles == idle);
+            CHECK(m.completed  == (int)procs.size());
+
+            long long sumWait = 0, sumResp = 0;
+            for (size_t i = 0; i < procs.size(); ++i) {
+                const auto& pm = e.processMetrics()[i];
+                CHECK(pm.firstRun   == firstRun[i]);
+                CHECK(pm.completion == e.procs()[i].completionTime);
+                sumWait += pm.completion - procs[i].arrival - procs[i].burst;
+                sumResp += firstRun[i] - procs[i].arrival;
+            }
+            CHECK(m.sumWaiting  == sumWait);
+            CHECK(m.sumResponse == sumResp);
+            CHECK(m.utilization() == Approx((double)busy / (busy + idle)));
+        }
+    }
+}
+
+TEST_CASE("WorkStealingPool ejecuta cada índice una vez", "[sweep]") {
+    WorkStealingPool pool(4);
+    for (size_t n : { 0, 1, 3, 1000 }) {
+        // las aserciones de Catch2 no son seguras entre hilos: los
+        // trabajadores sólo anotan y se comprueba tras el join
+        std::vector<std::atomic<int>> hits(n);
+        std::atomic<bool> badWorker{false};
+        pool.parallelFor(n, [&](size_t i, unsigned w) {
+            if (w >= pool.size()) badWorker = true;
+            hits[i]++;
+        });
+        CHECK_FALSE(badWorker);
+        for (size_t i = 0; i < n; ++i) CHECK(hits[i] == 1);
+    }
+
+    CHECK_THROWS_AS(pool.parallelFor(10, [](size_t i, unsigned) {
+        if (i == 7) throw std::runtime_error("falla");
+    }), std::runtime_error);
+}
+
+TEST_CASE("El barrido paralelo coincide con simular punto a punto", "[sweep]") {
+    SweepGrid grid;
+    grid.algorithms = { SchedulingAlgo::FIFO, SchedulingAlgo::RR, SchedulingAlgo::SRT };
+    grid.quantumMin = 1;
+    grid.quantumMax = 4;
+    for (unsigned seed = 1; seed <= 6; ++seed) {
+        SweepWorkload wl;
+        wl.name = "w" + std::to_string(seed);
+        makeWorkload(seed, wl.processes, wl.resources, wl.actions);
+        grid.workloads.push_back(wl);
+    }
+
+    auto results = runSweep(grid, 3);
+    REQUIRE(results.size() == grid.workloads.size() * (2 + 4));
+
+    for (const auto& r : results) {
+        const SweepWorkload& wl = grid.workloads[r.point.workload];
+        CHECK((r.point.quantum > 0) == usesQuantum(r.point.algo));
+
+        SimulationEngine e(wl.processes, wl.resources, wl.actions, r.point.algo,
+                           std::max(1, r.point.quantum));
+        while (!e.isFinished()) e.advanceToNextEvent();
+        CHECK(r.metrics.sumWaiting    == e.metrics().sumWaiting);
+        CHECK(r.metrics.sumTurnaround == e.metrics().sumTurnaround);
+        CHECK(r.metrics.busyCycles    == e.metrics().busyCycles);
+        CHECK(r.metrics.idleCycles    == e.metrics().idleCycles);
+    }
+
+    // cada punto con los núcleos y el reparto de la rejilla
+    grid.cores     = 2;
+    grid.balancing = CoreBalancing::WORK_STEALING;
+    for (const auto& r : runSweep(grid, 2)) {
+        const SweepWorkload& wl = grid.workloads[r.point.workload];
+        SimulationEngine e(wl.processes, wl.resources, wl.actions, r.point.algo,
+                           std::max(1, r.point.quantum));
+        e.setCores(2, CoreBalancing::WORK_STEALING);
+        while (!e.isFinished()) e.advanceToNextEvent();
+        CHECK(r.metrics.sumWaiting == e.metrics().sumWaiting);
+        CHECK(r.metrics.migrations == e.metrics().migrations);
+        CHECK(r.metrics.idleCycles == e.metrics().idleCycles);
+    }
+    grid.cores = 0;
+    CHECK_THROWS_AS(expandSweepGrid(grid), std::invalid_argument);
+
+    // y con el período de boost de MLFQ de la rejilla
+    grid.cores      = 1;
+    grid.algorithms = { SchedulingAlgo::MLFQ };
+    for (int boost : { 0, 5 }) {
+        grid.mlfqBoostPeriod = boost;
+        for (const auto& r : runSweep(grid, 2)) {
+            const SweepWorkload& wl = grid.workloads[r.point.workload];
+            SimulationEngine e(wl.processes, wl.resources, wl.actions, r.point.algo,
+                               r.point.quantum);
+            e.mlfqBoostPeriod_ = boost;
+            while (!e.isFinished()) e.advanceToNextEvent();
+            CHECK(r.metrics.sumWaiting    == e.metrics().sumWaiting);
+            CHECK(r.metrics.sumTurnaround == e.metrics().sumTurnaround);
+        }
+    }
+}
+
+TEST_CASE("El barrido en modo unificado compara los algoritmos con bloqueos", "[sweep][unified]") {
+    SweepGrid grid;
+    grid.algorithms = { SchedulingAlgo::FIFO, SchedulingAlgo::RR, SchedulingAlgo::PRIORITY };
+    grid.quantumMin = 1;
+    grid.quantumMax = 2;
+    grid.mode       = SimMode::UNIFIED;
+    for (unsigned seed = 1; seed <= 4; ++seed) {
+        SweepWorkload wl;
+        wl.name = "seed" + std::to_string(seed);
+        makeWorkload(seed, wl.processes, wl.resources, wl.actions);
+        grid.workloads.push_back(std::move(wl));
+    }
+
+    for (const auto& r : runSweep(grid, 2)) {
+        const SweepWorkload& wl = grid.workloads[r.point.workload];
+        SimulationEngine e(wl.processes, wl.resources, wl.actions, r.point.algo,
+                           std::max(1, r.point.quantum));
+        e.setMode(SimMode::UNIFIED);
+        while (!e.isFinished()) e.advanceToNextEvent();
+        CHECK(r.metrics.completed    == e.metrics().completed);
+        CHECK(r.metrics.sumLockWait  == e.metrics().sumLockWait);
+        CHECK(r.metrics.sumReadyWait == e.metrics().sumReadyWait);
+        CHECK(r.metrics.busyCycles   == e.metrics().busyCycles);
+    }
+
+    grid.mode = SimMode::SYNCHRONIZATION;
+    CHECK_THROWS_AS(expandSweepGrid(grid), std::invalid_argument);
+}
+
+TEST_CASE("seekTo restaura desde checkpoints igual que re-simular", "[engine][checkpoint]") {
+    for (unsigned seed = 1; seed <= 20; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        for (SimMode mode : { SimMode::SCHEDULING, SimMode::SYNCHRONIZATION }) {
+            SimulationEngine e(procs, res, acts, SchedulingAlgo::RR, 2);
+            e.setMode(mode);
+            e.setCheckpointInterval(5);
+            e.runUntil(200);
+            const int end = e.currentCycle();
+            if (end >= 5) CHECK(e.checkpointCount() > 0);
+
+            for (int target : { end / 2, 0, -1, end, 3, end - 1, end / 3 }) {
+                e.seekTo(target);
+
+                SimulationEngine fresh(procs, res, acts, SchedulingAlgo::RR, 2);
+                fresh.setMode(mode);
+                fresh.runUntil(target);
+
+                requireSameRun(e, fresh);
+                CHECK(e.runningIndex() == fresh.runningIndex());
+                CHECK(e.metrics().sumWaiting == fresh.metrics().sumWaiting);
+                CHECK(e.metrics().busyCycles == fresh.metrics().busyCycles);
+            }
+
+            // tras volver atrás la simulación sigue igual que sin checkpoints
+            SimulationEngine fresh(procs, res, acts, SchedulingAlgo::RR, 2);
+            fresh.setMode(mode);
+            e.runUntil(200);
+            fresh.runUntil(200);
+            requireSameRun(e, fresh);
+        }
+    }
+}
+
+TEST_CASE("Los checkpoints se descartan al cambiar la configuración", "[engine][checkpoint]") {
+    std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+    makeWorkload(3, procs, res, acts);
+
+    SimulationEngine e(procs, res, acts, SchedulingAlgo::RR, 1);
+    e.setCheckpointInterval(2);
+    e.runUntil(10);
+    REQUIRE(e.checkpointCount() > 0);
+
+    const size_t before = e.checkpointCount();
+    e.rrQuantum_ = 3;
+    e.seekTo(4);
+    // los de quantum 1 se descartaron; sólo quedan los del nuevo recorrido
+    CHECK(e.checkpointCount() < before);
+
+    SimulationEngine fresh(procs, res, acts, SchedulingAlgo::RR, 3);
+    fresh.runUntil(4);
+    requireSameRun(e, fresh);
+}
+
+TEST_CASE("Los checkpoints no pasan del tope y se espacian al ralear", "[engine][checkpoint]") {
+    std::vector<Process> procs;
+    for (int i = 0; i < 60; ++i)
+        procs.push_back({ "P" + std::to_string(i), 5 + i % 7, i * 3, i % 4 });
+
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::RR, 2);
+    e.setCheckpointInterval(1);
+    e.runUntil(INT_MAX - 1);
+    const int end = e.currentCycle();
+    REQUIRE(end > (int)SimulationEngine::MAX_CHECKPOINTS * 4);
+    CHECK(e.checkpointCount() < SimulationEngine::MAX_CHECKPOINTS);
+    CHECK(e.checkpointStride() >= 4);
+    CHECK(e.checkpointInterval() == 1);
+
+    for (int target : { end / 2, 7, end - 1, end / 3 }) {
+        e.seekTo(target);
+        SimulationEngine fresh(procs, {}, {}, SchedulingAlgo::RR, 2);
+        fresh.runUntil(target);
+        requireSameRun(e, fresh);
+        CHECK(e.metrics().sumWaiting == fresh.metrics().sumWaiting);
+    }
+    CHECK(e.checkpointCount() < SimulationEngine::MAX_CHECKPOINTS);
+
+    // al cambiar la configuración se vuelve al intervalo pedido
+    e.rrQuantum_ = 3;
+    e.seekTo(0);
+    CHECK(e.checkpointStride() == 1);
+}
+
+TEST_CASE("fork comparte las entradas y continúa de forma independiente", "[engine][fork]") {
+    std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+    makeWorkload(11, procs, res, acts);
+
+    SimulationEngine base(procs, res, acts, SchedulingAlgo::SRT);
+    base.runUntil(8);
+
+    std::vector<SimulationEngine> forks;
+    for (int i = 0; i < 1000; ++i) forks.push_back(base.fork());
+    CHECK(forks[0].workload() == base.workload());
+
+    // una rama cambia de algoritmo sin afectar a las demás
+    forks[1].setAlgorithm(SchedulingAlgo::FIFO);
+    forks[1].runUntil(200);
+    forks[0].runUntil(200);
+    base.runUntil(200);
+    requireSameRun(forks[0], base);
+    CHECK(forks[2].currentCycle() == 8);
+
+    SimulationEngine fresh(procs, res, acts, SchedulingAlgo::SRT);
+    fresh.runUntil(200);
+    requireSameRun(base, fresh);
+}
+
+TEST_CASE("Varios núcleos: por eventos reproduce la ejecución ciclo a ciclo", "[engine][cores]") {
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        for (CoreBalancing b : { CoreBalancing::GLOBAL, CoreBalancing::WORK_STEALING }) {
+            for (int cores : { 2, 3, 8 }) {
+                for (int algo = 0; algo < SCHEDULING_ALGO_COUNT; ++algo) {
+                    SimulationEngine byTick (procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+                    SimulationEngine byEvent(procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+                    byTick.setCores(cores, b);
+                    byEvent.setCores(cores, b);
+
+                    while (!byTick.isFinished())  byTick.tick();
+                    while (!byEvent.isFinished()) byEvent.advanceToNextEvent();
+                    requireSameRun(byTick, byEvent);
+                    CHECK(byTick.metrics().migrations == byEvent.metrics().migrations);
+
+                    // cada proceso corre en un solo núcleo por ciclo y
+                    // recibe exactamente su ráfaga
+                    std::vector<int> ran(procs.size(), 0);
+                    for (int cycle = 0; cycle <= byTick.currentCycle(); ++cycle) {
+                        std::vector<int> seen;
+                        for (int c = 0; c < cores; ++c) {
+                            int idx = byTick.getExecutionHistory(c).procAt(cycle);
+                            if (idx < 0) continue;
+                            CHECK(std::find(seen.begin(), seen.end(), idx) == seen.end());
+                            seen.push_back(idx);
+                            ran[idx]++;
+                        }
+                    }
+                    for (size_t i = 0; i < procs.size(); ++i)
+                        CHECK(ran[i] == procs[i].burst);
+
+                    const Metrics& m = byTick.metrics();
+                    long long busy = 0;
+                    for (const CoreMetrics& cm : m.cores) busy += cm.busyCycles;
+                    CHECK(busy == m.busyCycles);
+                    CHECK(m.elapsed() == byTick.currentCycle() + 1);
+                }
+            }
+        }
+    }
+}
+
+TEST_CASE("Con un núcleo ambos repartos equivalen al motor original", "[engine][cores]") {
+    for (unsigned seed = 1; seed <= 20; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        for (int algo = 0; algo < SCHEDULING_ALGO_COUNT; ++algo) {
+            SimulationEngine single  (procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+            SimulationEngine stealing(procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+            stealing.setCores(1, CoreBalancing::WORK_STEALING);
+
+            single.runUntil(INT_MAX - 1);
+            stealing.runUntil(INT_MAX - 1);
+            requireSameRun(single, stealing);
+            CHECK(stealing.metrics().migrations == 0);
+        }
+    }
+}
+
+TEST_CASE("Cola global: SRT expropia al núcleo con más remaining", "[engine][cores]") {
+    std::vector<Process> procs = {
+        { "A", 10, 0, 0 }, { "B", 6, 0, 0 }, { "C", 2, 1, 0 }
+    };
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::SRT);
+    e.setCores(2);
+
+    e.runUntil(1);
+    CHECK(e.runningIndex(0) == 1);    // B (menor remaining) en el primer núcleo libre
+    CHECK(e.runningIndex(1) == 2);    // C desplaza a A, el peor en ejecución
+    CHECK(e.readyCount() == 1);
+
+    e.runUntil(INT_MAX - 1);
+    CHECK(e.procs()[2].completionTime == 3);
+    CHECK(e.procs()[1].completionTime == 6);
+    CHECK(e.procs()[0].completionTime == 12);
+    CHECK(e.metrics().migrations == 0);
+}
+
+TEST_CASE("Robo de trabajo: los núcleos ociosos se llevan procesos ajenos", "[engine][cores]") {
+    // A y C van a la cola del núcleo 0, B y D a la del 1. El núcleo 0 se
+    // queda sin trabajo en el ciclo 5 y roba D; B sigue sólo en el núcleo 1.
+    std::vector<Process> procs = {
+        { "A", 1, 0, 0 }, { "B", 8, 0, 0 }, { "C", 4, 0, 0 }, { "D", 4, 0, 0 }
+    };
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::RR, 2);
+    e.setCores(2, CoreBalancing::WORK_STEALING);
+    e.runUntil(INT_MAX - 1);
+
+    CHECK(e.getExecutionHistory(0).procAt(5) == 3);
+    CHECK(e.procs()[3].completionTime == 7);
+    CHECK(e.procs()[1].completionTime == 10);
+
+    const Metrics& m = e.metrics();
+    CHECK(m.completed  == 4);
+    CHECK(m.migrations == 1);
+    CHECK(m.elapsed()  == 10);
+    CHECK(m.cores[0].busyCycles == 7);
+    CHECK(m.cores[1].busyCycles == 10);
+    CHECK(m.loadImbalance() == Approx(10.0f * 2 / 17 - 1));
+}
+
+TEST_CASE("seekTo con varios núcleos", "[engine][cores][checkpoint]") {
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        SimulationEngine e(procs, res, acts, SchedulingAlgo::RR, 1);
+        e.setCores(4, CoreBalancing::WORK_STEALING);
+        e.setCheckpointInterval(3);
+        e.runUntil(200);
+
+        for (int target : { e.currentCycle() / 2, 1, -1 }) {
+            e.seekTo(target);
+            SimulationEngine fresh(procs, res, acts, SchedulingAlgo::RR, 1);
+            fresh.setCores(4, CoreBalancing::WORK_STEALING);
+            fresh.runUntil(target);
+            requireSameRun(e, fresh);
+            CHECK(e.metrics().migrations == fresh.metrics().migrations);
+        }
+    }
+}
+
+TEST_CASE("CFS reparte la CPU según el peso del nice", "[engine][cfs]") {
+    // Dos procesos largos con nice 0 y 5: pesos 1024 y 335
+    std::vector<Process> procs = { { "A", 5000, 0, 0 }, { "B", 5000, 0, 5 } };
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::CFS, 1);
+    e.runUntil(1358);
+
+    int ranA = 0;
+    for (const auto& seg : e.getExecutionHistory().segments())
+        if (seg.procIdx == 0) ranA += seg.length;
+    CHECK(ranA == Approx(1359.0 * 1024 / (1024 + 335)).margin(2));
+}
+
+TEST_CASE("CFS: quien llega tarde arranca desde el vruntime mínimo", "[engine][cfs]") {
+    // C llega con vruntime 0 pero se lo sube al piso: no acapara la CPU
+    std::vector<Process> procs = { { "A", 50, 0, 0 }, { "B", 50, 0, 0 }, { "C", 10, 40, 0 } };
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::CFS, 2);
+    e.runUntil(INT_MAX - 1);
+
+    const auto& h = e.getExecutionHistory();
+    int longest = 0;
+    for (const auto& seg : h.segments())
+        if (seg.procIdx == 2) longest = std::max(longest, seg.length);
+    CHECK(longest <= 3);
+    CHECK(e.metrics().completed == 3);
+}
+
+TEST_CASE("MLFQ baja de nivel al agotar el quantum y el boost lo devuelve", "[engine][mlfq]") {
+    // A es larga y va bajando (quantum 1, 2, 4); B llega en el ciclo 5 al
+    // nivel 0 y expropia a A en cuanto entra
+    std::vector<Process> procs = { { "A", 30, 0, 0 }, { "B", 2, 5, 0 } };
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::MLFQ, 1);
+    e.mlfqBoostPeriod_ = 0;
+    e.runUntil(INT_MAX - 1);
+
+    const auto& h = e.getExecutionHistory();
+    CHECK(h.procAt(5) == 1);
+    CHECK(h.procAt(6) == 1);
+    CHECK(e.procs()[1].completionTime == 7);
+
+    // Con boost, A vuelve al nivel 0 y un recién llegado comparte el nivel
+    // por orden de llegada en lugar de expropiar
+    std::vector<Process> boosted = { { "A", 30, 0, 0 }, { "B", 4, 20, 0 } };
+    SimulationEngine b(boosted, {}, {}, SchedulingAlgo::MLFQ, 1);
+    b.mlfqBoostPeriod_ = 20;
+    b.runUntil(INT_MAX - 1);
+    CHECK(b.getExecutionHistory().procAt(20) == 0);
+    CHECK(b.getExecutionHistory().procAt(21) == 1);
+}
+
+// Política propia: el trabajo más largo primero, sin tocar el motor
+struct LongestJobFirst : PolicyBase<LongestJobFirst> {
+    static constexpr const char*       name       = "LJF";
+    static constexpr ReadyQueue::Order order      = ReadyQueue::Order::MIN_KEY;
+    static constexpr bool              tieByIndex = true;
+    static long long key(const SchedContext& c, int idx) { return -(long long)c.wl.burst[idx]; }
+};
+
+TEST_CASE("Una política propia se instancia con setPolicy", "[engine][policy]") {
+    std::vector<Process> procs = { { "A", 3, 0, 0 }, { "B", 8, 0, 0 }, { "C", 5, 0, 0 } };
+    SimulationEngine e(procs, {}, {}, SchedulingAlgo::FIFO);
+    e.setPolicy<LongestJobFirst>();
+    e.reset();
+    CHECK(std::string(e.policyName()) == "LJF");
+
+    e.runUntil(INT_MAX - 1);
+    CHECK(e.procs()[1].completionTime == 8);
+    CHECK(e.procs()[2].completionTime == 13);
+    CHECK(e.procs()[0].completionTime == 16);
+
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::vector<Process> ps; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, ps, res, acts);
+        for (int cores : { 1, 3 }) {
+            SimulationEngine byTick (ps, res, acts, SchedulingAlgo::FIFO);
+            SimulationEngine byEvent(ps, res, acts, SchedulingAlgo::FIFO);
+            for (SimulationEngine* s : { &byTick, &byEvent }) {
+                s->setPolicy<LongestJobFirst>();
+                s->setCores(cores);
+            }
+            while (!byTick.isFinished()) byTick.tick();
+            while (!byEvent.isFinished()) byEvent.advanceToNextEvent();
+            requireSameRun(byTick, byEvent);
+        }
+    }
+}
+
+TEST_CASE("Modo unificado: quien espera un mutex deja la CPU hasta el RELEASE", "[engine][unified]") {
+    std::vector<Process>  procs = { { "A", 4, 0, 0 }, { "B", 4, 0, 0 } };
+    std::vector<Resource> res   = { { "M", 1 } };
+    // los ciclos de las acciones cuentan tiempo ejecutado por cada proceso
+    std::vector<Action>   acts  = {
+        syncAct("A", "ADQUIRE", "M", 0), syncAct("B", "ADQUIRE", "M", 0),
+        syncAct("A", "RELEASE", "M", 3), syncAct("B", "RELEASE", "M", 2),
+    };
+
+    SimulationEngine e(procs, res, acts, SchedulingAlgo::FIFO);
+    e.setMode(SimMode::UNIFIED);
+    e.setCores(2);
+    e.runUntil(INT_MAX - 1);
+    REQUIRE(e.isFinished());
+
+    // B se bloquea antes de su primer ciclo y entra en cuanto A suelta
+    CHECK(e.getExecutionHistory(1).segments() ==
+          std::vector<ExecSegment>{ { -1, 0, 3 }, { 1, 3, 4 } });
+    CHECK(e.procs()[1].completionTime == 7);
+    const ProcessMetrics& b = e.processMetrics()[1];
+    CHECK(b.waiting == 3);
+    CHECK(b.lockWait == 3);
+    CHECK(b.readyWait == 0);
+    CHECK(e.metrics().sumLockWait == 3);
+    CHECK(e.metrics().maxLockWait == 3);
+
+    const auto& log = e.getSyncLog();
+    REQUIRE(log.size() == 5);
+    CHECK(log[1].pidIdx == 1);
+    CHECK(log[1].result == SyncResult::WAITING);
+    CHECK(log[3].cycle == 3);
+    CHECK(log[3].pidIdx == 1);
+    CHECK(log[3].action == SyncAction::ADQUIRE);
+    CHECK(log[4].cycle == 5);   // B lleva 2 ciclos ejecutados
+    requireTimelineMatchesLog(e);
+
+    // con un núcleo B corre después de A y el mutex ya está libre
+    SimulationEngine one(procs, res, acts, SchedulingAlgo::FIFO);
+    one.setMode(SimMode::UNIFIED);
+    one.runUntil(INT_MAX - 1);
+    CHECK(one.processMetrics()[1].lockWait == 0);
+    CHECK(one.processMetrics()[1].readyWait == 4);
+}
+
+TEST_CASE("Modo unificado: un interbloqueo termina la simulación", "[engine][unified][deadlock]") {
+    std::vector<Process>  procs = { { "A", 4, 0, 0 }, { "B", 4, 0, 0 }, { "C", 3, 1, 0 } };
+    std::vector<Resource> res   = { { "M0", 1 }, { "M1", 1 } };
+    std::vector<Action>   acts  = {
+        syncAct("A", "ADQUIRE", "M0", 0), syncAct("B", "ADQUIRE", "M1", 0),
+        syncAct("A", "ADQUIRE", "M1", 1), syncAct("B", "ADQUIRE", "M0", 1),
+    };
+    SimulationEngine e(procs, res, acts, SchedulingAlgo::RR);
+    e.setMode(SimMode::UNIFIED);
+    e.setCores(2);
+    e.runUntil(INT_MAX - 1);
+
+    CHECK(e.isFinished());
+    CHECK(e.currentCycle() == 3);
+    CHECK(e.metrics().completed == 1);
+    CHECK(e.procs()[0].state == ProcState::BLOCKED);
+    CHECK(e.procs()[1].state == ProcState::BLOCKED);
+    CHECK(deadlocksAt(e, 1) == std::vector<std::pair<int, int>>{ { 0, 1 }, { 1, 0 } });
+}
+
+TEST_CASE("Modo unificado: por eventos y seekTo reproducen la ejecución ciclo a ciclo", "[engine][unified][checkpoint]") {
+    for (unsigned seed = 1; seed <= 30; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        for (int cores : { 1, 3 }) {
+            for (int algo = 0; algo < SCHEDULING_ALGO_COUNT; ++algo) {
+                SimulationEngine byTick (procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+                SimulationEngine byEvent(procs, res, acts, static_cast<SchedulingAlgo>(algo), 2);
+                for (SimulationEngine* s : { &byTick, &byEvent }) {
+                    s->setMode(SimMode::UNIFIED);
+                    s->setCores(cores);
+                }
+                while (!byTick.isFinished())  byTick.tick();
+                while (!byEvent.isFinished()) byEvent.advanceToNextEvent();
+                requireSameRun(byTick, byEvent);
+                requireTimelineMatchesLog(byTick);
+
+                // la espera se reparte entre recursos y cola de listos
+                const Metrics& m = byTick.metrics();
+                for (const ProcessMetrics& pm : byTick.processMetrics()) {
+                    if (pm.completion < 0) continue;
+                    CHECK(pm.lockWait >= 0);
+                    CHECK(pm.readyWait >= 0);
+                    CHECK(pm.lockWait + pm.readyWait == pm.waiting);
+                }
+                CHECK(m.sumLockWait + m.sumReadyWait == m.sumWaiting);
+            }
+        }
+
+        SimulationEngine e(procs, res, acts, SchedulingAlgo::RR, 2);
+        e.setMode(SimMode::UNIFIED);
+        e.setCheckpointInterval(4);
+        e.runUntil(INT_MAX - 1);
+        const int end = e.currentCycle();
+        for (int target : { end / 2, 0, end, 3 }) {
+            e.seekTo(target);
+            SimulationEngine fresh(procs, res, acts, SchedulingAlgo::RR, 2);
+            fresh.setMode(SimMode::UNIFIED);
+            fresh.runUntil(target);
+            requireSameRun(e, fresh);
+            CHECK(e.metrics().sumLockWait == fresh.metrics().sumLockWait);
+        }
+    }
+}
+
+// Lee instantáneas hasta que `done` se cumpla (o se agote el tiempo)
+template <class Pred>
+static bool pollUntil(SimulationRunner& runner, SimView& view, Pred done) {
+    const auto limit = std::chrono::steady_clock::now() + std::chrono::seconds(20);
+    while (std::chrono::steady_clock::now() < limit) {
+        runner.poll(view);
+        if (view.ready() && done(view.state())) return true;
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return false;
+}
+
+static void requireViewMatches(const SimView& view, const SimulationEngine& e) {
+    REQUIRE(view.state().cycle == e.currentCycle());
+    REQUIRE(view.coreCount() == e.coreCount());
+    for (int c = 0; c < e.coreCount(); ++c)
+        REQUIRE(view.history(c).segments() == e.getExecutionHistory(c).segments());
+    REQUIRE(view.syncLog().size() == e.getSyncLog().size());
+    for (size_t i = 0; i < e.getSyncLog().size(); ++i) {
+        CHECK(view.syncLog()[i].cycle  == e.getSyncLog()[i].cycle);
+        CHECK(view.syncLog()[i].pidIdx == e.getSyncLog()[i].pidIdx);
+        CHECK(view.syncLog()[i].action == e.getSyncLog()[i].action);
+    }
+    CHECK(view.state().metrics.sumWaiting == e.metrics().sumWaiting);
+}
+
+TEST_CASE("El hilo de simulación publica lo mismo que simular en línea", "[engine][runner]") {
+    for (unsigned seed = 1; seed <= 10; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        SimulationEngine engine(procs, res, acts, SchedulingAlgo::SRT);
+        engine.setCores(2);
+        engine.setCheckpointInterval(5);
+        SimulationRunner runner(engine.fork());
+        SimView view;
+
+        // a máxima velocidad hasta el final
+        runner.setRate(0);
+        runner.play(true);
+        REQUIRE(pollUntil(runner, view, [](const SimSnapshot& s){ return s.finished && !s.playing; }));
+        SimulationEngine direct = engine.fork();
+        direct.runUntil(INT_MAX - 1);
+        requireViewMatches(view, direct);
+
+        // volver atrás recorta lo que ve la interfaz
+        runner.seekTo(4);
+        REQUIRE(pollUntil(runner, view, [](const SimSnapshot& s){ return s.cycle == 4; }));
+        SimulationEngine fresh = engine.fork();
+        fresh.runUntil(4);
+        requireViewMatches(view, fresh);
+
+        // un paso y a ritmo fijo desde ahí, con la configuración cambiada
+        runner.configure([](SimulationEngine& e) { e.setAlgorithm(SchedulingAlgo::RR); });
+        runner.step();
+        runner.setRate(2000);
+        runner.play(true);
+        REQUIRE(pollUntil(runner, view, [](const SimSnapshot& s){ return s.finished; }));
+        fresh.setAlgorithm(SchedulingAlgo::RR);
+        fresh.tick();
+        fresh.runUntil(INT_MAX - 1);
+        requireViewMatches(view, fresh);
+        CHECK(view.state().algo == SchedulingAlgo::RR);
+
+        // modo sincronización tras reiniciar. El reset abre una época nueva:
+        // hasta verla, lo publicado puede ser el final anterior ya con el
+        // modo cambiado
+        const uint32_t before = view.state().epoch;
+        runner.configure([](SimulationEngine& e) { e.setMode(SimMode::SYNCHRONIZATION); });
+        runner.reset();
+        runner.setRate(0);
+        runner.play(true);
+        REQUIRE(pollUntil(runner, view, [before](const SimSnapshot& s){
+            return s.epoch != before && s.mode == SimMode::SYNCHRONIZATION &&
+                   s.finished && !s.playing; }));
+        SimulationEngine sync = engine.fork();
+        sync.setAlgorithm(SchedulingAlgo::RR);
+        sync.setMode(SimMode::SYNCHRONIZATION);
+        sync.runUntil(INT_MAX - 1);
+        requireViewMatches(view, sync);
+        for (ResourceKind kind : { ResourceKind::MUTEX, ResourceKind::SEMAPHORE,
+                                   ResourceKind::RWLOCK }) {
+            auto mine = view.syncTimeline().events(kind, 0, INT_MAX);
+            auto ref  = sync.syncTimeline().events(kind, 0, INT_MAX);
+            CHECK(std::vector<int>(mine.begin(), mine.end()) ==
+                  std::vector<int>(ref.begin(), ref.end()));
+        }
+    }
+}
+
+TEST_CASE("El hilo de simulación termina una corrida unificada", "[engine][runner][unified]") {
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        std::vector<Process> procs; std::vector<Resource> res; std::vector<Action> acts;
+        makeWorkload(seed, procs, res, acts);
+
+        SimulationEngine engine(procs, res, acts, SchedulingAlgo::RR, 2);
+        engine.setMode(SimMode::UNIFIED);
+        SimulationRunner runner(engine.fork());
+        SimView view;
+
+        // termina cuando el motor lo dice, no en el último ciclo de acciones
+        runner.setRate(0);
+        runner.play(true);
+        REQUIRE(pollUntil(runner, view, [](const SimSnapshot& s){ return s.finished && !s.playing; }));
+        engine.runUntil(INT_MAX - 1);
+        CHECK(engine.isFinished());
+        CHECK(view.state().mode == SimMode::UNIFIED);
+        requireViewMatches(view, engine);
+    }
+}
@@ -62,4 +62,69 @@ TEST_CASE("loadResources y loadActions", "[parser]") {
     CHECK(acts[1].type  == "WRITE");
     CHECK(acts[1].res   == "R2");
     CHECK(acts[1].cycle ==  5);
+    CHECK(acts[1].kind  == SyncAction::WRITE);
+}
+
+TEST_CASE("Un RW lock se declara con su política en lugar de la capacidad", "[parser]") {
+    const std::string fn = "tmp_rw.txt";
+    writeFile(fn, "BD, RW_WRITERS\nR1, 1\n");
+    auto res = loadResources(fn);
+    REQUIRE(res.size() == 2);
+    CHECK(res[0].rwLock);
+    CHECK(res[0].rwPolicy == RwPolicy::WRITERS);
+    CHECK_FALSE(res[1].rwLock);
+
+    writeFile(fn, "BD, RW_RANDOM\n");
+    REQUIRE_THROWS_AS(loadResources(fn), std::runtime_error);
+}
+
+TEST_CASE("loadActions rechaza tipos de acción desconocidos", "[parser]") {
+    const std::string fn = "tmp_bad_act.txt";
+    writeFile(fn, "P1, BORROW, R1, 0\n");
+    REQUIRE_THROWS_AS(loadActions(fn), std::runtime_error);
+}
+
+TEST_CASE("Los errores indican archivo y línea", "[parser]") {
+    const std::string fn = "tmp_bad_line.txt";
+    writeFile(fn,
+        "P1, 5, 0, 2\n"
+        "\n"
+        "P2, 1x, 3, 1\n"
+    );
+    REQUIRE_THROWS_WITH(loadProcesses(fn),
+                        Catch::Contains("tmp_bad_line.txt:3:") && Catch::Contains("P2, 1x"));
+}
+
+TEST_CASE("Acepta CRLF, espacios finales y última línea sin salto", "[parser]") {
+    const std::string fn = "tmp_crlf.txt";
+    writeFile(fn, "R1, 1     \r\n   \r\nR2,+3");
+    auto res = loadResources(fn);
+    REQUIRE(res.size() == 2);
+    CHECK(res[0].count == 1);
+    CHECK(res[1].name  == "R2");
+    CHECK(res[1].count == 3);
+}
+
+TEST_CASE("El parseo por bloques en paralelo da el mismo resultado", "[parser]") {
+    const std::string fn = "tmp_many_procs.txt";
+    std::string content;
+    for (int i = 0; i < 5000; ++i)
+        content += "P" + std::to_string(i) + ", " + std::to_string(i % 17 + 1) + ", "
+                 + std::to_string(i / 3) + ", " + std::to_string(i % 5) + "\n";
+    writeFile(fn, content);
+
+    auto seq = loadProcesses(fn, 1);
+    REQUIRE(seq.size() == 5000);
+    for (unsigned threads : { 2u, 3u, 8u }) {
+        auto par = loadProcesses(fn, threads);
+        REQUIRE(par.size() == seq.size());
+        for (size_t i = 0; i < seq.size(); ++i) {
+            CHECK(par[i].pid     == seq[i].pid);
+            CHECK(par[i].arrival == seq[i].arrival);
+        }
+    }
+
+    // el número de línea es absoluto aunque el error caiga en otro bloque
+    writeFile(fn, content + "P9, x, 0, 0\n");
+    REQUIRE_THROWS_WITH(loadProcesses(fn, 4), Catch::Contains(":5001:"));
 }
@@ -0,0 +1,329 @@
+#define CATCH_CONFIG_MAIN
+#include <catch2/catch.hpp>
+#include "workload/WorkloadGenerator.h"
+#include "simulation/SimulationEngine.h"
+#include "simulation/CompiledWorkload.h"
+#include "simulation/ParameterSweep.h"
+#include "Parser.h"
+#include "io/BinaryWorkload.h"
+
+#include <climits>
+#include <cstddef>
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+static VectorSink generate(const WorkloadConfig& cfg) {
+    VectorSink sink;
+    generateWorkload(cfg, sink);
+    return sink;
+}
+
+TEST_CASE("La misma semilla produce la misma carga", "[workload]") {
+    WorkloadConfig cfg;
+    cfg.processes = 500;
+    cfg.seed = 42;
+    VectorSink a = generate(cfg);
+    VectorSink b = generate(cfg);
+
+    REQUIRE(a.processes.size() == 500);
+    REQUIRE(a.actions.size() == b.actions.size());
+    for (size_t i = 0; i < a.processes.size(); ++i) {
+        CHECK(a.processes[i].burst    == b.processes[i].burst);
+        CHECK(a.processes[i].arrival  == b.processes[i].arrival);
+        CHECK(a.processes[i].priority == b.processes[i].priority);
+    }
+
+    cfg.seed = 43;
+    VectorSink c = generate(cfg);
+    bool differs = c.actions.size() != a.actions.size();
+    for (size_t i = 0; i < a.processes.size() && !differs; ++i)
+        differs = a.processes[i].burst != c.processes[i].burst;
+    CHECK(differs);
+}
+
+TEST_CASE("Las distribuciones respetan la configuración", "[workload]") {
+    WorkloadConfig cfg;
+    cfg.processes   = 20000;
+    cfg.arrivalRate = 0.25;
+    cfg.burstMean   = 10;
+    cfg.priorityWeights = { 3, 0, 1 };
+    VectorSink w = generate(cfg);
+
+    double sumBurst = 0;
+    int prio0 = 0;
+    for (size_t i = 0; i < w.processes.size(); ++i) {
+        const auto& p = w.processes[i];
+        sumBurst += p.burst;
+        CHECK(p.burst >= 1);
+        CHECK(p.priority != 1);
+        if (p.priority == 0) prio0++;
+        if (i > 0) CHECK(p.arrival >= w.processes[i - 1].arrival);
+    }
+    // ceil() de una exponencial de media 10 → media ≈ 10.5
+    CHECK(sumBurst / cfg.processes == Approx(10.5).epsilon(0.05));
+    CHECK((double)prio0 / cfg.processes == Approx(0.75).epsilon(0.05));
+    CHECK(w.processes.back().arrival / (double)cfg.processes == Approx(4.0).epsilon(0.05));
+
+    // cada sección abre y cierra sobre el mismo recurso
+    REQUIRE(w.actions.size() % 2 == 0);
+    for (size_t i = 0; i < w.actions.size(); i += 2) {
+        CHECK(w.actions[i].res == w.actions[i + 1].res);
+        CHECK(w.actions[i].cycle < w.actions[i + 1].cycle);
+    }
+}
+
+TEST_CASE("Con execTime las acciones cuentan desde el inicio de la ráfaga", "[workload][unified]") {
+    WorkloadConfig cfg;
+    cfg.processes = 2000;
+    cfg.rwLocks   = 1;
+    VectorSink abs = generate(cfg);
+    cfg.execTime  = true;
+    VectorSink rel = generate(cfg);
+
+    // mismos sorteos: sólo se descuenta la llegada de cada proceso
+    REQUIRE(rel.actions.size() == abs.actions.size());
+    size_t p = 0;
+    for (size_t i = 0; i < rel.actions.size(); ++i) {
+        while (abs.processes[p].pid != rel.actions[i].pid) p++;
+        CHECK(rel.actions[i].cycle == abs.actions[i].cycle - abs.processes[p].arrival);
+        if (i % 2 == 0) CHECK(rel.actions[i].cycle < abs.processes[p].burst);
+    }
+}
+
+TEST_CASE("FileSink escribe en el formato del parser", "[workload]") {
+    WorkloadConfig cfg;
+    cfg.processes = 200;
+    cfg.burstDist = WorkloadConfig::BurstDist::BIMODAL;
+    cfg.rwLocks   = 2;
+    cfg.rwPolicy  = RwPolicy::READERS;
+    VectorSink mem = generate(cfg);
+
+    const std::string base = "lls_workload_test_";
+    {
+        FileSink files(base + "p.txt", base + "r.txt", base + "a.txt");
+        generateWorkload(cfg, files);
+    }
+    auto procs = loadProcesses(base + "p.txt");
+    auto res   = loadResources(base + "r.txt");
+    auto acts  = loadActions(base + "a.txt");
+    std::remove((base + "p.txt").c_str());
+    std::remove((base + "r.txt").c_str());
+    std::remove((base + "a.txt").c_str());
+
+    REQUIRE(procs.size() == mem.processes.size());
+    REQUIRE(res.size()   == mem.resources.size());
+    REQUIRE(acts.size()  == mem.actions.size());
+    for (size_t i = 0; i < res.size(); ++i) {
+        CHECK(res[i].rwLock == mem.resources[i].rwLock);
+        if (res[i].rwLock) CHECK(res[i].rwPolicy == RwPolicy::READERS);
+    }
+    for (size_t i = 0; i < acts.size(); ++i) {
+        CHECK(acts[i].pid   == mem.actions[i].pid);
+        CHECK(acts[i].kind  == mem.actions[i].kind);
+        CHECK(acts[i].cycle == mem.actions[i].cycle);
+    }
+
+    SimulationEngine e(mem.processes, mem.resources, mem.actions, SchedulingAlgo::SRT);
+    while (!e.isFinished()) e.advanceToNextEvent();
+    CHECK(e.metrics().completed == (int)procs.size());
+}
+
+TEST_CASE("La carga binaria reproduce la de texto", "[workload][binary]") {
+    WorkloadConfig cfg;
+    cfg.processes = 300;
+    cfg.sectionsPerProcess = 2.0;
+    cfg.rwLocks  = 1;
+    cfg.rwPolicy = RwPolicy::WRITERS;
+    VectorSink w = generate(cfg);
+    // acciones sobre PIDs y recursos no declarados, fuera de orden
+    w.actions.push_back({ "P9999", "WAIT", "S1", 3, SyncAction::WAIT });
+    w.actions.push_back({ "P1", "ADQUIRE", "NOPE", 1, SyncAction::ADQUIRE });
+
+    const std::string fn = "lls_workload_test.llw";
+    writeBinaryWorkload(fn, w.processes, w.resources, w.actions);
+    {
+        BinaryWorkload bin(fn);
+        REQUIRE(bin.processCount() == w.processes.size());
+        REQUIRE(bin.actionCount()  == w.actions.size());
+        CHECK(bin.pid(7) == w.processes[7].pid);
+        CHECK(bin.undeclaredPidCount() == 1);
+        CHECK(bin.undeclaredResCount() == 1);
+        for (uint64_t i = 1; i < bin.actionCount(); ++i)
+            CHECK(bin.actionCycle()[i - 1] <= bin.actionCycle()[i]);
+
+        // ida y vuelta: mismos procesos y mismas acciones (ya ordenadas)
+        auto acts = bin.actions();
+        size_t undeclared = 0;
+        for (const auto& a : acts) undeclared += (a.pid == "P9999") + (a.res == "NOPE");
+        CHECK(undeclared == 2);
+        CHECK(bin.processes()[42].burst == w.processes[42].burst);
+        auto res = bin.resources();
+        REQUIRE(res.size() == w.resources.size());
+        CHECK(res.back().rwLock);
+        CHECK(res.back().rwPolicy == RwPolicy::WRITERS);
+
+        // compilada desde las columnas: nombres bajo demanda
+        auto cw = CompiledWorkload::compile(bin);
+        REQUIRE(cw->processCount() == w.processes.size());
+        CHECK(cw->pid(7) == w.processes[7].pid);
+        CHECK(cw->burst[42] == w.processes[42].burst);
+        CHECK(cw->procs()[42].pid == w.processes[42].pid);
+
+        // el barrido acepta la carga ya compilada, sin volver a los vectores
+        SweepGrid grid;
+        grid.algorithms = { SchedulingAlgo::FIFO, SchedulingAlgo::RR };
+        grid.quantumMax = 2;
+        grid.workloads.push_back({ "texto", w.processes, w.resources, w.actions, nullptr });
+        grid.workloads.push_back({ fn, {}, {}, {}, cw });
+        auto sweep = runSweep(grid, 2);
+        REQUIRE(sweep.size() == 6);
+        for (size_t i = 0; i < 3; ++i) {
+            CHECK(sweep[i].metrics.sumWaiting == sweep[i + 3].metrics.sumWaiting);
+            CHECK(sweep[i].metrics.elapsed()  == sweep[i + 3].metrics.elapsed());
+        }
+
+        for (SimMode mode : { SimMode::SCHEDULING, SimMode::SYNCHRONIZATION, SimMode::UNIFIED }) {
+            SimulationEngine fromText(w.processes, w.resources, w.actions, SchedulingAlgo::RR, 2);
+            SimulationEngine fromBin (bin, SchedulingAlgo::RR, 2);
+            fromText.setMode(mode);
+            fromBin.setMode(mode);
+            fromText.runUntil(400);
+            fromBin.runUntil(400);
+
+            CHECK(fromText.getExecutionHistory().segments() ==
+                  fromBin.getExecutionHistory().segments());
+            const auto& la = fromText.getSyncLog();
+            const auto& lb = fromBin.getSyncLog();
+            REQUIRE(la.size() == lb.size());
+            for (size_t i = 0; i < la.size(); ++i) {
+                CHECK(la[i].pidIdx == lb[i].pidIdx);
+                CHECK(la[i].res    == lb[i].res);
+                CHECK(la[i].result == lb[i].result);
+            }
+        }
+    }
+    std::remove(fn.c_str());
+}
+
+TEST_CASE("La carga binaria rechaza archivos inválidos", "[workload][binary]") {
+    const std::string fn = "lls_not_binary.llw";
+    {
+        std::ofstream out(fn);
+        out << "P1, 5, 0, 1\n";
+    }
+    CHECK_THROWS_AS(BinaryWorkload(fn), std::runtime_error);
+    std::remove(fn.c_str());
+}
+
+// Sobrescribe un valor del archivo en `off`
+template <class T>
+static void patch(const std::string& fn, uint64_t off, T value) {
+    std::fstream f(fn, std::ios::binary | std::ios::in | std::ios::out);
+    f.seekp((std::streamoff)off);
+    f.write(reinterpret_cast<const char*>(&value), sizeof value);
+}
+
+TEST_CASE("La carga binaria valida la capacidad de los recursos", "[workload][binary]") {
+    const std::string fn = "lls_capacity.llw";
+    std::vector<Process>  procs = { { "P1", 5, 0, 1 } };
+    std::vector<Resource> res   = { { "S", 2 }, { "L", 1, true, RwPolicy::WRITERS } };
+    writeBinaryWorkload(fn, procs, res, {});
+
+    BinaryWorkload::Header h;
+    {
+        std::ifstream in(fn, std::ios::binary);
+        in.read(reinterpret_cast<char*>(&h), sizeof h);
+    }
+    CHECK(h.version == BinaryWorkload::VERSION);
+    const uint64_t capS = h.offCapacity, capL = h.offCapacity + 4;
+    const uint64_t lockS = h.offResLock, lockL = h.offResLock + 1;
+    const uint64_t version = offsetof(BinaryWorkload::Header, version);
+
+    // versión 3: la capacidad nunca es negativa y el lock es 0 o una política
+    patch(fn, capS, -1);
+    CHECK_THROWS_AS(BinaryWorkload(fn), std::runtime_error);
+    patch(fn, capS, 2);
+    patch(fn, lockL, (uint8_t)((int)RwPolicy::FAIR + 2));
+    CHECK_THROWS_AS(BinaryWorkload(fn), std::runtime_error);
+    patch(fn, lockL, (uint8_t)((int)RwPolicy::FAIR + 1));
+    CHECK(BinaryWorkload(fn).resources()[1].rwPolicy == RwPolicy::FAIR);
+
+    // la versión 2 guardaba el RW lock como capacidad -(p+1) y no tenía la
+    // columna lock
+    patch(fn, version, 2);
+    CHECK_FALSE(BinaryWorkload(fn).resources()[1].rwLock);
+    patch(fn, lockS, (uint8_t)1);
+    CHECK_FALSE(BinaryWorkload(fn).resources()[0].rwLock);
+    for (int32_t bad : { -4, -100, INT32_MIN }) {
+        patch(fn, capL, bad);
+        CHECK_THROWS_AS(BinaryWorkload(fn), std::runtime_error);
+    }
+    patch(fn, capL, -1 - (int32_t)RwPolicy::READERS);
+    {
+        auto v2 = BinaryWorkload(fn).resources();
+        CHECK(v2[1].rwLock);
+        CHECK(v2[1].rwPolicy == RwPolicy::READERS);
+        CHECK(v2[0].count == 2);
+    }
+
+    // la versión 1 no tenía RW locks: sólo cuentas, que pueden ser 0
+    patch(fn, version, 1);
+    CHECK_THROWS_AS(BinaryWorkload(fn), std::runtime_error);
+    patch(fn, capL, 0);
+    patch(fn, capS, 3);
+    {
+        auto v1 = BinaryWorkload(fn).resources();
+        CHECK_FALSE(v1[1].rwLock);
+        CHECK(v1[1].count == 0);
+        CHECK(v1[0].count == 3);
+    }
+    patch(fn, version, 4);
+    CHECK_THROWS_AS(BinaryWorkload(fn), std::runtime_error);
+    std::remove(fn.c_str());
+
+    // un semáforo de señalización (cuenta 0) va y vuelve como tal
+    res[0].count = 0;
+    writeBinaryWorkload(fn, procs, res, {});
+    {
+        auto back = BinaryWorkload(fn).resources();
+        CHECK_FALSE(back[0].rwLock);
+        CHECK(back[0].count == 0);
+        CHECK(back[1].rwLock);
+        CHECK(back[1].rwPolicy == RwPolicy::WRITERS);
+    }
+    std::remove(fn.c_str());
+}
+
+TEST_CASE("Una cuenta negativa no se confunde con un RW lock", "[workload][binary]") {
+    const std::string txt = "lls_negative.txt", fn = "lls_negative.llw";
+
+    // ni el parser ni el escritor la aceptan
+    for (const char* line : { "R1, -1\n", "R2, -5\n" }) {
+        {
+            std::ofstream out(txt);
+            out << line;
+        }
+        CHECK_THROWS_AS(loadResources(txt), std::runtime_error);
+    }
+    std::remove(txt.c_str());
+    for (int count : { -1, -5 }) {
+        std::vector<Resource> res = { { "R", count } };
+        CHECK_THROWS_AS(writeBinaryWorkload(fn, {}, res, {}), std::runtime_error);
+    }
+
+    // cada política y cada cuenta válida vuelve igual
+    std::vector<Resource> res = { { "R1", 1 }, { "R2", 5 } };
+    for (RwPolicy p : { RwPolicy::READERS, RwPolicy::WRITERS, RwPolicy::FAIR })
+        res.push_back({ std::string("L") + rwPolicyName(p), 1, true, p });
+    writeBinaryWorkload(fn, {}, res, {});
+    auto back = BinaryWorkload(fn).resources();
+    REQUIRE(back.size() == res.size());
+    for (size_t i = 0; i < res.size(); ++i) {
+        CHECK(back[i].name   == res[i].name);
+        CHECK(back[i].rwLock == res[i].rwLock);
+        CHECK(back[i].count  == res[i].count);
+        if (res[i].rwLock) CHECK(back[i].rwPolicy == res[i].rwPolicy);
+    }
+    std::remove(fn.c_str());
+}
@@ -5,6 +5,8 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <random>
+#include <algorithm>
+#include <chrono>
 
 ImGuiLayer::ImGuiLayer(
     const char* title,
@@ -20,23 +22,86 @@ ImGuiLayer::ImGuiLayer(
   , processes_(&processes)
   , resources_(&resources)
   , actions_(&actions)
-  , engine_(
-      processes,      // origProcs
-      resources,      // origRes
-      actions,        // origActs
-      SchedulingAlgo::FIFO,  // algoritmo por defecto
-      /*rrQuantum=*/1
-    )
+  , runner_([&]{
+        SimulationEngine engine(
+          processes,      // origProcs
+          resources,      // origRes
+          actions,        // origActs
+          SchedulingAlgo::FIFO,  // algoritmo por defecto
+          /*rrQuantum=*/1
+        );
+        engine.setCheckpointInterval(DEFAULT_CHECKPOINT_INTERVAL);
+        return engine;
+    }())
 {
+    runner_.setRate(rate_);
+    runner_.poll(view_);
     init();
     assignPidColors();
 }
 
 ImGuiLayer::~ImGuiLayer()
 {
+    // Las comparaciones pendientes se abandonan; el pool espera a que salgan
+    cancelWork_ = true;
     cleanup();
 }
 
+std::pair<int, int> ImGuiLayer::comparisonKey(SchedulingAlgo algo, int quantum) const {
+    // El quantum sólo distingue resultados de los algoritmos que lo usan
+    return { static_cast<int>(algo), usesQuantum(algo) ? quantum : 0 };
+}
+
+void ImGuiLayer::requestComparison(SchedulingAlgo algo, int quantum) {
+    auto key = comparisonKey(algo, quantum);
+    if (comparisonCache_.count(key) || comparisonTasks_.count(key)) return;
+
+    ComparisonTask task;
+    task.progress = std::make_shared<std::atomic<float>>(0.0f);
+    task.cancel   = std::make_shared<std::atomic<bool>>(false);
+
+    // Cada tarea tiene su propio motor sobre el workload compartido
+    // (inmutable), con los mismos núcleos que la simulación principal
+    task.result = workers_.submit(
+        [wl = runner_.workload(), algo, quantum,
+         cores = cores_, balancing = balancing_,
+         boost = boostPeriod_, mode = mode_,
+         progress = task.progress, cancel = task.cancel, closing = &cancelWork_]()
+        {
+            SimulationEngine engine(wl, algo, quantum);
+            engine.setMode(mode);
+            engine.mlfqBoostPeriod_ = boost;
+            engine.setCores(cores, balancing);
+            const float total = (float)std::max<size_t>(1, wl->processCount());
+            while (!engine.isFinished() && !cancel->load() && !closing->load()) {
+                engine.advanceToNextEvent();
+                progress->store(engine.metrics().completed / total);
+            }
+            return engine.metrics();
+        });
+
+    comparisonTasks_.emplace(key, std::move(task));
+}
+
+void ImGuiLayer::discardComparisons() {
+    for (auto& [key, task] : comparisonTasks_)
+        task.cancel->store(true);
+    comparisonTasks_.clear();
+    comparisonCache_.clear();
+}
+
+void ImGuiLayer::pollComparisons() {
+    for (auto it = comparisonTasks_.begin(); it != comparisonTasks_.end(); ) {
+        auto& fut = it->second.result;
+        if (fut.wait_for(std::chrono::seconds(0)) == std::future_status::ready) {
+            comparisonCache_[it->first] = fut.get();
+            it = comparisonTasks_.erase(it);
+        } else {
+            ++it;
+        }
+    }
+}
+
 void ImGuiLayer::init()
 {
 
@@ -78,12 +143,15 @@ void ImGuiLayer::assignPidColors() {
 
 void ImGuiLayer::renderLoop()
 {
-    static double last = glfwGetTime();
     while (!glfwWindowShouldClose(window))
     {
-        double now = glfwGetTime();
         glfwPollEvents();
 
+        // Lo último que publicó el hilo de simulación; no lo espera
+        runner_.poll(view_);
+        const SimSnapshot& snap = view_.state();
+        const auto&        pids = runner_.workload()->procs();
+
         ImGui_ImplOpenGL3_NewFrame();
         ImGui_ImplGlfw_NewFrame();
         ImGui::NewFrame();
@@ -92,38 +160,61 @@ void ImGuiLayer::renderLoop()
 
         // ── Selector de modo ─────────────────────────────────────────
         static int mode = 0;
+        static int appliedMode = 0;
         ImGui::Text("Modo:");
         ImGui::SameLine(); ImGui::RadioButton("Calendarización", &mode, 0);
         ImGui::SameLine(); ImGui::RadioButton("Sincronización",  &mode, 1);
-        engine_.setMode(mode == 0 ? SimMode::SCHEDULING : SimMode::SYNCHRONIZATION);
+        ImGui::SameLine(); ImGui::RadioButton("Unificado",       &mode, 2);
+        if (mode != appliedMode) {
+            SimMode m = mode == 0 ? SimMode::SCHEDULING
+                      : mode == 1 ? SimMode::SYNCHRONIZATION : SimMode::UNIFIED;
+            runner_.configure([m](SimulationEngine& e) { e.setMode(m); });
+            appliedMode = mode;
+            // las comparaciones guardadas no bloqueaban procesos (o sí)
+            if ((m == SimMode::UNIFIED) != (mode_ == SimMode::UNIFIED)) {
+                discardComparisons();
+            }
+            mode_ = m;
+        }
 
         // ── Controles comunes ─────────────────────────────────────────
-        if (ImGui::Button(running_ ? "Pause" : "Start")) running_ = !running_;
+        if (ImGui::Button(snap.playing ? "Pause" : "Start")) runner_.play(!snap.playing);
         ImGui::SameLine();
-        if (ImGui::Button("Step")) {
-            engine_.tick();
-            if (engine_.isFinished()) running_ = false;
-        }
-        ImGui::SameLine();
-        if (ImGui::Button("Reset")) {
-            engine_.reset();
-            running_ = false;
-        }
+        if (ImGui::Button("Step")) runner_.step();
         ImGui::SameLine();
-        ImGui::SliderFloat("Speed", &speed_, 0.1f, 10.0f);
+        if (ImGui::Button("Reset")) runner_.reset();
 
-        // ── Auto-tick en cualquiera de los modos ──────────────────────
-        if (running_ && now - last >= 1.0 / speed_) {
-            engine_.tick();
-            last = now;
-            if (engine_.isFinished()) running_ = false;
-        }
+        // Línea de tiempo: arrastrar hacia atrás restaura el checkpoint más
+        // cercano en lugar de re-simular desde el inicio
+        int scrub = snap.cycle;
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(200);
+        if (ImGui::SliderInt("Ciclo##timeline", &scrub, -1, std::max(0, snap.timelineEnd)))
+            runner_.seekTo(scrub);
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(120);
+        if (ImGui::SliderInt("Checkpoint cada", &checkpointInterval_, 0, 1000, "%d ciclos",
+                             ImGuiSliderFlags_Logarithmic))
+            runner_.configure([k = checkpointInterval_](SimulationEngine& e) {
+                e.setCheckpointInterval(k);
+            });
+
+        // Ritmo del hilo de simulación, independiente de los cuadros
+        ImGui::SameLine();
+        ImGui::SetNextItemWidth(200);
+        bool rateChanged = ImGui::SliderFloat("Ciclos/s", &rate_, 0.1f, 100000.0f, "%.1f",
+                                              ImGuiSliderFlags_Logarithmic);
+        ImGui::SameLine();
+        rateChanged |= ImGui::Checkbox("Máxima", &maxRate_);
+        if (rateChanged) runner_.setRate(maxRate_ ? 0.0 : rate_);
 
         //---- Variables para el panel de métricas de calendarización ----
-        static bool selected[5] = { true, false, false, false, false };  // FCFS activo por defecto
-        static const char* algoNames[5] = { "FCFS", "SJF", "SRT", "RR", "Priority" };
+        static bool selected[SCHEDULING_ALGO_COUNT] = { true };  // FCFS activo por defecto
+        static const char* algoNames[SCHEDULING_ALGO_COUNT] =
+            { "FCFS", "SJF", "SRT", "RR", "Priority", "CFS", "MLFQ" };
 
-        if (mode == 0) {
+        // En modo unificado se ven los dos paneles
+        if (mode != 1) {
             // —————— PANEL DE CALENDARIZACIÓN ——————
             if (ImGui::CollapsingHeader("Simulación (Calendarización)")) {
                 ImGui::Text("Algoritmo de calendarización:");
@@ -134,41 +225,100 @@ void ImGuiLayer::renderLoop()
                 ImGui::SameLine(); ImGui::RadioButton("SRT##gantt",      &algoIdx, 2);
                 ImGui::SameLine(); ImGui::RadioButton("RR##gantt",       &algoIdx, 3);
                 ImGui::SameLine(); ImGui::RadioButton("Priority##gantt", &algoIdx, 4);
-
-                if (engine_.getAlgorithm() != static_cast<SchedulingAlgo>(algoIdx)) {
-                    engine_.setAlgorithm(static_cast<SchedulingAlgo>(algoIdx));
-                    engine_.reset();
-                    running_ = false;
+                ImGui::SameLine(); ImGui::RadioButton("CFS##gantt",      &algoIdx, 5);
+                ImGui::SameLine(); ImGui::RadioButton("MLFQ##gantt",     &algoIdx, 6);
+
+                static int appliedAlgo = 0;
+                if (algoIdx != appliedAlgo) {
+                    SchedulingAlgo algo = static_cast<SchedulingAlgo>(algoIdx);
+                    runner_.configure([algo](SimulationEngine& e) { e.setAlgorithm(algo); });
+                    runner_.reset();
+                    appliedAlgo = algoIdx;
                 }
 
-                if(algoIdx == static_cast<int>(SchedulingAlgo::RR)) {
-                    ImGui::SliderInt("Quantum", &engine_.rrQuantum_, 1, 10);
+                if (usesQuantum(static_cast<SchedulingAlgo>(algoIdx))) {
+                    if (ImGui::SliderInt("Quantum", &quantum_, 1, 10))
+                        runner_.configure([q = quantum_](SimulationEngine& e) { e.rrQuantum_ = q; });
+                }
+                if (algoIdx == static_cast<int>(SchedulingAlgo::MLFQ)) {
+                    // las comparaciones guardadas usaban el período anterior
+                    if (ImGui::SliderInt("Boost MLFQ (ciclos)", &boostPeriod_, 0, 200)) {
+                        runner_.configure([b = boostPeriod_](SimulationEngine& e) { e.mlfqBoostPeriod_ = b; });
+                        discardComparisons();
+                    }
                 }
 
-                ImGui::Text("Ciclo: %d", engine_.currentCycle());
+                // Núcleos: cambiar la cantidad o el reparto reinicia la
+                // simulación y descarta las comparaciones ya calculadas
+                static int cores = 1;
+                static int balancingIdx = 0;
+                ImGui::SetNextItemWidth(200);
+                ImGui::SliderInt("Núcleos", &cores, 1, 128);
+                ImGui::SameLine(); ImGui::RadioButton("Cola global",    &balancingIdx, 0);
+                ImGui::SameLine(); ImGui::RadioButton("Robo de trabajo", &balancingIdx, 1);
+                CoreBalancing balancing = balancingIdx == 0 ? CoreBalancing::GLOBAL
+                                                            : CoreBalancing::WORK_STEALING;
+                if (cores_ != cores || balancing_ != balancing) {
+                    runner_.configure([n = cores, balancing](SimulationEngine& e) {
+                        e.setCores(n, balancing);
+                    });
+                    runner_.play(false);
+                    cores_     = cores;
+                    balancing_ = balancing;
+                    discardComparisons();
+                }
 
-                ImGui::Text("Running PID: %s",
-                    engine_.runningIndex() < 0
-                        ? "idle"
-                        : engine_.procs()[engine_.runningIndex()].pid.c_str()
-                );
+                ImGui::Text("Ciclo: %d", snap.cycle);
 
+                for (int c = 0; c < (int)snap.running.size(); ++c) {
+                    int idx = snap.running[c];
+                    ImGui::Text("Running PID (CPU %d): %s", c,
+                                idx < 0 ? "idle" : pids[idx].pid.c_str());
+                }
 
-                ImGui::Text("Ready queue:");
-                for (auto idx : engine_.readyQueue()) {
-                    ImGui::SameLine();
-                    ImGui::Text("%s", engine_.procs()[idx].pid.c_str());
+                // Una línea por cola: la compartida o la de cada núcleo (la
+                // instantánea trae hasta READY_SHOWN por cola)
+                const int queues = (int)snap.ready.size();
+                for (int q = 0; q < queues; ++q) {
+                    if (queues == 1) ImGui::Text("Ready queue:");
+                    else             ImGui::Text("Ready queue (CPU %d):", q);
+                    for (auto idx : snap.ready[q]) {
+                        ImGui::SameLine();
+                        ImGui::Text("%s", pids[idx].pid.c_str());
+                    }
+                    if (snap.ready[q].size() == SimulationRunner::READY_SHOWN) {
+                        ImGui::SameLine();
+                        ImGui::Text("... (%zu en total)", snap.readyCount);
+                    }
                 }
 
-                if (engine_.isFinished()) {
-                    float avgWait = engine_.getAverageWaitingTime();
-                    ImGui::Separator();
-                    ImGui::Text("Resumen de eficiencia:");
-                    ImGui::Text("Tiempo promedio de espera: %.2f ciclos", avgWait);
+                // Métricas en vivo (el motor las mantiene de forma incremental)
+                const Metrics& m = snap.metrics;
+                ImGui::Separator();
+                ImGui::Text("Resumen de eficiencia%s:", snap.finished ? "" : " (parcial)");
+                ImGui::Text("Tiempo promedio de espera: %.2f ciclos (máx %d)",
+                            m.avgWaiting(), m.maxWaiting);
+                if (snap.mode == SimMode::UNIFIED)
+                    ImGui::Text("  bloqueado en recursos: %.2f (máx %d)  |  en cola de listos: %.2f",
+                                m.avgLockWait(), m.maxLockWait, m.avgReadyWait());
+                ImGui::Text("Tiempo promedio de retorno: %.2f ciclos (máx %d)",
+                            m.avgTurnaround(), m.maxTurnaround);
+                ImGui::Text("Tiempo promedio de respuesta: %.2f ciclos (máx %d)",
+                            m.avgResponse(), m.maxResponse);
+                ImGui::Text("Throughput: %.3f procesos/ciclo  |  Uso de CPU: %.1f%%",
+                            m.throughput(), m.utilization() * 100.0f);
+                if (m.cpuCount() > 1) {
+                    ImGui::Text("Migraciones: %lld  |  Desbalance de carga: %.1f%%",
+                                m.migrations, m.loadImbalance() * 100.0f);
+                    for (int c = 0; c < m.cpuCount(); ++c) {
+                        ImGui::Text("CPU %d: %.1f%%", c, m.cores[c].utilization() * 100.0f);
+                        if ((c + 1) % 8 != 0 && c + 1 < m.cpuCount()) ImGui::SameLine();
+                    }
                 }
             }
             if (ImGui::CollapsingHeader("Diagrama de Gantt con ciclos y burst")) {
-                auto& history = engine_.getExecutionHistory();
+                const int   lanes   = view_.coreCount();
+                auto& history = view_.history();
                 const float boxW    = 30.0f;
                 const float boxH    = 25.0f;
                 const float spacing = 2.0f;
@@ -176,7 +326,9 @@ void ImGuiLayer::renderLoop()
 
                 const float topMargin    = 30;   
                 const float bottomMargin = 20;   
-                const float totalHeight  = (topMargin + boxH + bottomMargin);  
+                const float laneH        = boxH + bottomMargin;   // barra + burst acumulado
+                const float labelW       = lanes > 1 ? 50.0f : 0.0f;
+                const float totalHeight  = (topMargin + lanes * laneH);  
 
                 ImGui::BeginChild("GanttScroll",
                     ImGui::GetContentRegionAvail(),
@@ -185,51 +337,74 @@ void ImGuiLayer::renderLoop()
                 );
 
                 ImVec2 startPos = ImGui::GetCursorScreenPos();
+                startPos.x += labelW;
                 auto  drawList = ImGui::GetWindowDrawList();
 
-                // Dibuja TODOS los ciclos arriba 
+                // Sólo lo que cae en la ventana de scroll: el costo por cuadro
+                // no depende del largo del historial
+                const float step       = boxW + spacing;
+                const float viewX      = ImGui::GetScrollX() - labelW;
+                const int   firstCycle = std::max(0, (int)(viewX / step));
+                const int   lastCycle  = std::min(history.cycles(),
+                                                  (int)((viewX + ImGui::GetWindowWidth()) / step) + 1);
+                const float viewY      = ImGui::GetScrollY() - 10;
+                const int   firstLane  = std::max(0, (int)(viewY / laneH));
+                const int   lastLane   = std::min(lanes,
+                                                  (int)((viewY + ImGui::GetWindowHeight()) / laneH) + 1);
+
+                // Números de ciclo arriba
                 const float cycleOffsetY = startPos.y - 5;  
-                for (int i = 0; i < (int)history.size(); ++i) {
+                for (int i = firstCycle; i < lastCycle; ++i) {
                     std::string num = std::to_string(i);
                     float textW = ImGui::CalcTextSize(num.c_str()).x;
-                    float x = startPos.x + i*(boxW+spacing) + (boxW - textW)/2;
+                    float x = startPos.x + i*step + (boxW - textW)/2;
                     drawList->AddText({x, cycleOffsetY}, IM_COL32(200,200,200,255), num.c_str());
                 }
 
-                //  Dibuja barras y burst acumulado 
-                float x = startPos.x;
-                float y = startPos.y + 10;     
-                int cumulative = 0;
-                int segmentStart = 0;
-                for (int i = 0; i < (int)history.size(); ++i) {
-                    const auto& pid = history[i];
-                    ImU32 color = colorIdle;
-                    if (pidColors_.count(pid)) {
-                        color = pidColors_[pid];
+                //  Dibuja barras y burst acumulado: un rectángulo por tramo
+                //  del mismo proceso, un carril por núcleo
+                static const std::string idleLabel = "idle";
+                for (int lane = firstLane; lane < lastLane; ++lane) {
+                    float y = startPos.y + 10 + lane * laneH;
+                    if (lanes > 1) {
+                        std::string label = "CPU " + std::to_string(lane);
+                        drawList->AddText({startPos.x - labelW, y + 5},
+                                          IM_COL32(200,200,200,255), label.c_str());
                     }
+                    const auto& segs = view_.history(lane).segments();
+                    for (size_t s = view_.history(lane).segmentAt(firstCycle);
+                         s < segs.size() && segs[s].start < lastCycle; ++s) {
+                        const ExecSegment& seg = segs[s];
+                        const bool idle = (seg.procIdx == ExecutionHistory::IDLE);
+                        const std::string& pid = idle ? idleLabel : pids[seg.procIdx].pid;
+                        ImU32 color = colorIdle;
+                        if (!idle && pidColors_.count(pid)) {
+                            color = pidColors_[pid];
+                        }
 
-                    // barra
-                    drawList->AddRectFilled({x, y}, {x+boxW, y+boxH}, color);
-                    drawList->AddText({x+5,y+5}, IM_COL32(255,255,255,255), pid.c_str());
-
-                    bool isEnd = (i+1 == (int)history.size() || history[i+1] != pid);
-                    if (pid != "idle" && isEnd) {
-                        int length = i - segmentStart + 1;
-                        cumulative += length;      
-                        auto txt = std::to_string(cumulative);
-                        float tw = ImGui::CalcTextSize(txt.c_str()).x;
-                        float tx = x + (boxW - tw)/2;
-                        float ty = y + boxH + 2;   // justo debajo
-                        drawList->AddText({tx, ty}, IM_COL32(255,255,0,255), txt.c_str());
-                        segmentStart = i+1;
+                        // barra recortada a la parte visible; la etiqueta va
+                        // al inicio de lo que se ve
+                        const int   from = std::max(seg.start, firstCycle);
+                        const int   to   = std::min(seg.end(), lastCycle);
+                        const float x0   = startPos.x + from * step;
+                        const float x1   = startPos.x + to * step - spacing;
+                        drawList->AddRectFilled({x0, y}, {x1, y+boxH}, color);
+                        drawList->AddText({x0+5,y+5}, IM_COL32(255,255,255,255), pid.c_str());
+
+                        // burst acumulado = ciclo en que termina el tramo
+                        if (!idle && seg.end() <= lastCycle) {
+                            auto txt = std::to_string(seg.end());
+                            float tw = ImGui::CalcTextSize(txt.c_str()).x;
+                            float tx = startPos.x + (seg.end() - 1) * step + (boxW - tw)/2;
+                            float ty = y + boxH + 2;   // justo debajo
+                            drawList->AddText({tx, ty}, IM_COL32(255,255,0,255), txt.c_str());
+                        }
                     }
-
-                    x += boxW + spacing;
                 }
 
                 // Reserva el espacio para el scroll 
                 ImGui::Dummy(ImVec2(
-                    history.size() * (boxW+spacing),
+                    labelW + history.cycles() * (boxW+spacing),
                     totalHeight
                 ));
 
@@ -237,17 +412,20 @@ void ImGuiLayer::renderLoop()
             }
             if (ImGui::CollapsingHeader("Resumen de métricas de calendarización")) {
                 ImGui::Text("Seleccione los algoritmos a comparar:");
-                for (int i = 0; i < 5; ++i) {
+                for (int i = 0; i < SCHEDULING_ALGO_COUNT; ++i) {
                     std::string label = std::string(algoNames[i]) + "##cmp";
                     ImGui::Checkbox(label.c_str(), &selected[i]);
-                    if (i < 4) ImGui::SameLine();
+                    if (i < SCHEDULING_ALGO_COUNT - 1) ImGui::SameLine();
                 }
 
-                // Slider para configurar Quantum (si se selecciona RR)
+                // Slider para configurar Quantum (si algún algoritmo elegido lo usa)
                 static int quantumForComparison = 1;
-                bool rrSelected = selected[static_cast<int>(SchedulingAlgo::RR)];
-                if (rrSelected) {
-                    ImGui::SliderInt("Quantum (para RR)##cmp", &quantumForComparison, 1, 10);
+                bool quantumSelected = false;
+                for (int i = 0; i < SCHEDULING_ALGO_COUNT; ++i)
+                    if (selected[i] && usesQuantum(static_cast<SchedulingAlgo>(i)))
+                        quantumSelected = true;
+                if (quantumSelected) {
+                    ImGui::SliderInt("Quantum (RR / CFS / MLFQ)##cmp", &quantumForComparison, 1, 10);
                 }
 
                 static bool showResults = false;
@@ -255,47 +433,53 @@ void ImGuiLayer::renderLoop()
                     showResults = true;
                 }
 
-                SimulationEngine tempEngine = engine_;  
-                
                 if (showResults) {
+                    // Las simulaciones corren en el pool; el frame sólo lanza
+                    // lo que falte en caché y recoge lo que ya terminó
+                    for (int i = 0; i < SCHEDULING_ALGO_COUNT; ++i) {
+                        if (selected[i])
+                            requestComparison(static_cast<SchedulingAlgo>(i), quantumForComparison);
+                    }
+                    pollComparisons();
+
                     ImGui::Separator();
-                    ImGui::Text("Resultados (avg waiting time):");
+                    ImGui::Text("Resultados (promedios de espera / retorno / respuesta):");
 
-                    for (int i = 0; i < 5; ++i) {
+                    for (int i = 0; i < SCHEDULING_ALGO_COUNT; ++i) {
                         if (!selected[i]) continue;
 
-                        // 1. Configurar algoritmo
-                        tempEngine.setAlgorithm(static_cast<SchedulingAlgo>(i));
-
-                        // Si es RR, aplicar quantum configurado
-                        if (i == static_cast<int>(SchedulingAlgo::RR)) {
-                            tempEngine.rrQuantum_ = quantumForComparison;
-                        }
-
-                        // 2. Resetear simulación
-                        tempEngine.reset();
-
-                        // 3. Ejecutar simulación completa
-                        while (!tempEngine.isFinished()) {
-                            tempEngine.tick();
+                        auto key = comparisonKey(static_cast<SchedulingAlgo>(i), quantumForComparison);
+                        auto done = comparisonCache_.find(key);
+                        if (done != comparisonCache_.end()) {
+                            const Metrics& m = done->second;
+                            if (mode_ == SimMode::UNIFIED)
+                                ImGui::BulletText("%s: %.2f (%.2f bloqueado) / %.2f / %.2f ciclos",
+                                                  algoNames[i], m.avgWaiting(), m.avgLockWait(),
+                                                  m.avgTurnaround(), m.avgResponse());
+                            else
+                                ImGui::BulletText("%s: %.2f / %.2f / %.2f ciclos", algoNames[i],
+                                                  m.avgWaiting(), m.avgTurnaround(), m.avgResponse());
+                        } else {
+                            float progress = comparisonTasks_.at(key).progress->load();
+                            ImGui::BulletText("%s: calculando...", algoNames[i]);
+                            ImGui::SameLine();
+                            ImGui::ProgressBar(progress, ImVec2(150, 0));
                         }
-
-                        // 4. Calcular y mostrar métrica
-                        float avg = tempEngine.getAverageWaitingTime();
-                        ImGui::BulletText("%s: %.2f ciclos", algoNames[i], avg);
                     }
                 }
             } 
-        } else {
+        }
+        if (mode != 0) {
             // —————— PANEL DE SINCRONIZACIÓN ——————
             if (ImGui::CollapsingHeader("Simulación (Sincronización)")) {
-                ImGui::Text("Ciclo: %d", engine_.currentCycle());
+                ImGui::Text("Ciclo: %d", snap.cycle);
 
                 static int syncFilter = 0;
                 ImGui::Text("Ver:");
                 
                 ImGui::SameLine(); ImGui::RadioButton("Mutex",     &syncFilter, 0);
                 ImGui::SameLine(); ImGui::RadioButton("Semáforos", &syncFilter, 1);
+                ImGui::SameLine(); ImGui::RadioButton("RW locks",  &syncFilter, 2);
 
                 ImGui::Separator();
                 ImGui::Text("Leyenda:");
@@ -404,6 +588,40 @@ void ImGuiLayer::renderLoop()
                     ImGui::SameLine();
                 }
 
+                // — DEADLOCK (recuadro magenta sobre la celda) —
+                ImGui::Text("DEADLOCK"); ImGui::SameLine();
+                {
+                    ImVec2 p = ImGui::GetCursorScreenPos();
+                    dl->AddRectFilled({ p.x, p.y }, { p.x + iconSize, p.y + iconSize },
+                                      IM_COL32(255, 0, 255, 90));
+                    dl->AddRect({ p.x, p.y }, { p.x + iconSize, p.y + iconSize },
+                                IM_COL32(255, 0, 255, 255), 0.0f, 0, 2.0f);
+                    ImGui::Dummy({ iconSize + pad, iconSize });
+                    ImGui::SameLine();
+                }
+
+                // — RW lock: lector (círculo azul), escritor (rombo morado);
+                //   en espera sólo el contorno —
+                ImGui::Text("RW READ"); ImGui::SameLine();
+                {
+                    ImVec2 p = ImGui::GetCursorScreenPos();
+                    dl->AddCircleFilled({ p.x + iconSize*0.5f, p.y + iconSize*0.5f },
+                                        iconSize*0.5f, IM_COL32(0, 120, 255, 255));
+                    ImGui::Dummy({ iconSize + pad, iconSize });
+                    ImGui::SameLine();
+                }
+                ImGui::Text("RW WRITE"); ImGui::SameLine();
+                {
+                    ImVec2 p = ImGui::GetCursorScreenPos();
+                    ImVec2 c = { p.x + iconSize*0.5f, p.y + iconSize*0.5f };
+                    const float h = iconSize*0.5f;
+                    const ImU32 col = IM_COL32(200, 150, 255, 255);
+                    dl->AddTriangleFilled({ c.x - h, c.y }, { c.x, c.y - h }, { c.x + h, c.y }, col);
+                    dl->AddTriangleFilled({ c.x - h, c.y }, { c.x + h, c.y }, { c.x, c.y + h }, col);
+                    ImGui::Dummy({ iconSize + pad, iconSize });
+                    ImGui::SameLine();
+                }
+
                 ImGui::Separator();
 
                 // ----------------------------------------
@@ -420,59 +638,122 @@ void ImGuiLayer::renderLoop()
 
                 // Origen del área de dibujo (esquina superior izquierda del grid)
                 ImVec2 origin = ImGui::GetCursorScreenPos();
+                dl = ImGui::GetWindowDrawList();
+
+                // Ventana visible en ciclos y filas: sólo se piden al índice
+                // del motor los eventos que caen ahí
+                auto const& log      = view_.syncLog();
+                auto const& timeline = view_.syncTimeline();
+                const int   maxCycle = log.empty() ? 0 : log.back().cycle;
+                const int   rows     = (int)processes_->size();
+                const float stepX    = blockW + spX;
+                const float stepY    = blockH + spY;
+                const float rowsTop  = origin.y + stepY;
+                const float viewX    = ImGui::GetScrollX() - labelWidth;
+                const float viewY    = ImGui::GetScrollY() - stepY;
+                const int   firstCyc = std::max(0, (int)(viewX / stepX));
+                const int   lastCyc  = std::min(maxCycle + 1,
+                                                (int)((viewX + ImGui::GetWindowWidth()) / stepX) + 1);
+                const int   firstRow = std::max(0, (int)(viewY / stepY));
+                const int   lastRow  = std::min(rows,
+                                                (int)((viewY + ImGui::GetWindowHeight()) / stepY) + 1);
 
                 // ----------------------------------------
                 // 2) DIBUJAR ETIQUETAS DE CICLO (Encabezado)
                 // ----------------------------------------
-                auto const& log = engine_.getSyncLog();
-                int maxCycle = log.empty() ? 0 : log.back().cycle;
-                for (int c = 0; c <= maxCycle; ++c) {
-                    float x = origin.x + labelWidth + c * (blockW + spX);
+                for (int c = firstCyc; c < lastCyc; ++c) {
+                    float x = origin.x + labelWidth + c * stepX;
                     float y = origin.y;
-                    char buf[8];
-                    int  tx = std::snprintf(buf, sizeof(buf), "%d", c);
+                    char buf[12];
+                    std::snprintf(buf, sizeof(buf), "%d", c);
                     ImVec2 tsz = ImGui::CalcTextSize(buf);
                     dl->AddText({ x + (blockW - tsz.x)/2, y }, IM_COL32(200,200,200,255), buf);
                 }
 
                 // ----------------------------------------
-                // 3) CALCULAR POSICIÓN Y DIBUJAR NOMBRES
+                // 3) NOMBRES (una fila por proceso)
                 // ----------------------------------------
-                // Reserva fila para cada PID en orden de aparición
-                std::unordered_map<int, float> rowY;
-                float nextY = origin.y + blockH + spY;  
-                for (int i = 0; i < (int)processes_->size(); ++i) {
-                    rowY[i] = nextY;
+                for (int i = firstRow; i < lastRow; ++i) {
                     dl->AddText(
-                    { origin.x, nextY + (blockH - ImGui::GetFontSize())*0.5f },
+                    { origin.x, rowsTop + i*stepY + (blockH - ImGui::GetFontSize())*0.5f },
                     IM_COL32(255,255,255,255),
-                    engine_.procs()[i].pid.c_str()
+                    pids[i].pid.c_str()
                     );
-                    nextY += blockH + spY;
                 }
 
                 // ----------------------------------------
                 // 4) DIBUJAR BLOQUES DE EVENTOS
                 // ----------------------------------------
                 bool   viewMutex = (syncFilter == 0);
+                const ResourceKind kind = syncFilter == 0 ? ResourceKind::MUTEX
+                                        : syncFilter == 1 ? ResourceKind::SEMAPHORE
+                                        :                   ResourceKind::RWLOCK;
+
+                // Dentro de un ciclo los eventos van por proceso: se salta
+                // directo a la primera fila visible
+                static std::vector<int> visible;
+                visible.clear();
+                for (int c = firstCyc; c < lastCyc; ++c) {
+                    auto span = timeline.events(kind, c, c + 1);
+                    auto it = std::lower_bound(span.begin(), span.end(), firstRow,
+                        [&](int pos, int row){ return log[pos].pidIdx < row; });
+                    for (; it != span.end() && log[*it].pidIdx < lastRow; ++it)
+                        visible.push_back(*it);
+                }
 
                 const ImU32 colLock    = IM_COL32(0,200,255,255);
                 const ImU32 colUnlock  = IM_COL32(0,150,0,255);
                 const ImU32 colWait    = IM_COL32(200,0,0,255);
                 const ImU32 colSignal  = IM_COL32(255,200,0,255);
+                const ImU32 colDeadlock = IM_COL32(255,0,255,255);
+                const ImU32 colReader  = IM_COL32(0,120,255,255);
+                const ImU32 colWriter  = IM_COL32(200,150,255,255);
 
                 const float semRadius = blockW * 0.4f; 
                 const float halfSize  = semRadius; 
 
-                for (auto const& e : log) {
-                    bool isM = engine_.isMutex(e.res);
-                    if (viewMutex != isM) continue;
+                for (int pos : visible) {
+                    const SyncEvent& e = log[pos];
+                    const bool isM = viewMutex;
 
-                    float x = origin.x + labelWidth + e.cycle*(blockW+spX);
-                    float y = rowY[e.pidIdx];
+                    float x = origin.x + labelWidth + e.cycle*stepX;
+                    float y = rowsTop + e.pidIdx*stepY;
                     ImVec2 center = { x+blockW*0.5f, y+blockH*0.5f };
 
-                    if (isM) {
+                    if (e.action == SyncAction::DEADLOCK) {
+                        // va después de la espera del mismo ciclo: la tiñe
+                        // y la enmarca, en cualquiera de las dos vistas
+                        dl->AddRectFilled({ x, y }, { x + blockW, y + blockH },
+                                          IM_COL32(255,0,255,90));
+                        dl->AddRect({ x, y }, { x + blockW, y + blockH },
+                                    colDeadlock, 0.0f, 0, 2.0f);
+                    } else if (kind == ResourceKind::RWLOCK) {
+                        // ————— MODO RW LOCK —————
+                        // varios lectores en la misma columna = lectura compartida
+                        const bool ok = e.result == SyncResult::ACCESSED;
+                        if (e.action == SyncAction::READ) {
+                            if (ok) dl->AddCircleFilled(center, semRadius, colReader);
+                            else    dl->AddCircle(center, semRadius, colWait, 0, 2.0f);
+                        } else if (e.action == SyncAction::WRITE) {
+                            ImVec2 l = { center.x - halfSize, center.y };
+                            ImVec2 t = { center.x, center.y - halfSize };
+                            ImVec2 r = { center.x + halfSize, center.y };
+                            ImVec2 b = { center.x, center.y + halfSize };
+                            if (ok) {
+                                dl->AddTriangleFilled(l, t, r, colWriter);
+                                dl->AddTriangleFilled(l, r, b, colWriter);
+                            } else {
+                                dl->AddLine(l, t, colWait, 2.0f);
+                                dl->AddLine(t, r, colWait, 2.0f);
+                                dl->AddLine(r, b, colWait, 2.0f);
+                                dl->AddLine(b, l, colWait, 2.0f);
+                            }
+                        } else if (e.action == SyncAction::RELEASE) {
+                            dl->AddLine({ center.x - halfSize, center.y + halfSize },
+                                        { center.x + halfSize, center.y + halfSize },
+                                        colUnlock, 3.0f);
+                        }
+                    } else if (isM) {
                         // ————— MODO MUTEX —————
                         if (e.action == SyncAction::ADQUIRE) {
                             if (e.result == SyncResult::ACCESSED) {
@@ -585,21 +866,26 @@ void ImGuiLayer::renderLoop()
                 // ----------------------------------------
                 // 5) EXPANDIR PARA SCROLL HORIZONTAL
                 // ----------------------------------------
-                float totalW = labelWidth + (maxCycle+1)*(blockW + spX);
-                ImGui::Dummy(ImVec2(totalW, 0.0f));
+                float totalW = labelWidth + (maxCycle+1)*stepX;
+                ImGui::Dummy(ImVec2(totalW, (rows+1)*stepY));
 
                 ImGui::EndChild();
 
                 if (ImGui::CollapsingHeader("Estado de Recursos")) {
+                    // estado de la instantánea; los nombres y tipos son fijos
+                    const ResourceTable& table = runner_.workload()->resources;
                     // --- MUTEXES ---
                     ImGui::Text("Mutexes:");
-                    for (auto const& [name, m] : engine_.getMutexes()) {
+                    for (int r = 0; r < (int)table.names.size(); ++r) {
+                        if (!table.isMutex(r)) continue;
+                        const Mutex& m = snap.mutexes[table.slots[r]];
+                        const char* name = table.names[r].c_str();
                         ImGui::Bullet();
                         if (m.locked) {
                             // Muestra nombre y dueño
                             const std::string& ownerPid = 
-                                (m.ownerIdx >= 0 ? engine_.procs()[m.ownerIdx].pid : "??");
-                            ImGui::Text("%s: LOCKED por %s", name.c_str(), ownerPid.c_str());
+                                (m.ownerIdx >= 0 ? pids[m.ownerIdx].pid : "??");
+                            ImGui::Text("%s: LOCKED por %s", name, ownerPid.c_str());
 
                             // Muestra la cola de espera con los nombres
                             if (!m.waitQueue.empty()) {
@@ -607,7 +893,7 @@ void ImGuiLayer::renderLoop()
                                 ImGui::SameLine();
                                 for (size_t i = 0; i < m.waitQueue.size(); ++i) {
                                     int idxEnCola = m.waitQueue[i];             
-                                    const auto& pid = engine_.procs()[idxEnCola].pid;
+                                    const auto& pid = pids[idxEnCola].pid;
                                     ImGui::Text("%s%s", pid.c_str(), 
                                                 i+1 < m.waitQueue.size() ? ", " : "");
                                     if (i+1 < m.waitQueue.size())
@@ -617,17 +903,19 @@ void ImGuiLayer::renderLoop()
                                 ImGui::Text("  Cola de espera: (vacía)");
                             }
                         } else {
-                            ImGui::Text("%s: LIBRE", name.c_str());
+                            ImGui::Text("%s: LIBRE", name);
                         }
 
                     }
                     ImGui::Separator();
                     // --- SEMAPHORES ---
                     ImGui::Text("Semáforos:");
-                    for (auto const& [name, s] : engine_.getSemaphores()) {
+                    for (int r = 0; r < (int)table.names.size(); ++r) {
+                        if (table.kinds[r] != ResourceKind::SEMAPHORE) continue;
+                        const Semaphore& s = snap.semaphores[table.slots[r]];
                         ImGui::Bullet();
                         // Muestra el valor actual
-                        ImGui::Text("%s: valor = %d", name.c_str(), s.count);
+                        ImGui::Text("%s: valor = %d", table.names[r].c_str(), s.count);
 
                         // Muestra la cola de espera con los PIDs
                         if (!s.waitQueue.empty()) {
@@ -635,7 +923,7 @@ void ImGuiLayer::renderLoop()
                             ImGui::SameLine();
                             for (size_t i = 0; i < s.waitQueue.size(); ++i) {
                                 int idxEnCola = s.waitQueue[i].first;      
-                                const auto& pid = engine_.procs()[idxEnCola].pid;
+                                const auto& pid = pids[idxEnCola].pid;
                                 ImGui::Text("%s%s",
                                             pid.c_str(),
                                             (i + 1 < s.waitQueue.size()) ? ", " : "");
@@ -646,6 +934,29 @@ void ImGuiLayer::renderLoop()
                             ImGui::Text("  Cola de espera: (vacía)");
                         }
                     }
+                    ImGui::Separator();
+                    // --- RW LOCKS ---
+                    ImGui::Text("RW locks:");
+                    for (int r = 0; r < (int)table.names.size(); ++r) {
+                        if (!table.isRwLock(r)) continue;
+                        const RwLock& l = snap.rwlocks[table.slots[r]];
+                        const char* name = table.names[r].c_str();
+                        ImGui::Bullet();
+                        if (l.writerIdx >= 0)
+                            ImGui::Text("%s (%s): escribe %s", name, rwPolicyName(l.policy),
+                                        pids[l.writerIdx].pid.c_str());
+                        else if (!l.readers.empty())
+                            ImGui::Text("%s (%s): %d lectores", name, rwPolicyName(l.policy),
+                                        (int)l.readers.size());
+                        else
+                            ImGui::Text("%s (%s): LIBRE", name, rwPolicyName(l.policy));
+                        ImGui::Text("  Esperan: %d lectores, %d escritores",
+                                    (int)l.readQueue.size(), (int)l.writeQueue.size());
+                        ImGui::Text("  Lectores: máx. %d, promedio %.2f | Escrituras: %d, "
+                                    "espera media %.2f, máx. %d",
+                                    l.maxReaders, l.avgReaders(snap.cycle), l.writes,
+                                    l.avgWriterWait(), l.maxWriterWait);
+                    }
 
                 }
             }
@@ -678,10 +989,13 @@ void ImGuiLayer::showDataPanel() {
     // Lista de recursos
     if (ImGui::CollapsingHeader("Resources")) {
         for (const auto& r : *resources_) {
-            ImGui::BulletText(
-              "%s: count=%d",
-              r.name.c_str(), r.count
-            );
+            if (r.rwLock)
+                ImGui::BulletText("%s: %s", r.name.c_str(), rwPolicyName(r.rwPolicy));
+            else
+                ImGui::BulletText(
+                  "%s: count=%d",
+                  r.name.c_str(), r.count
+                );
         }
     }
 
@@ -8,6 +8,12 @@
 #include "Resource.h"
 #include "Action.h"
 #include "simulation/SimulationEngine.h" 
+#include "simulation/SimulationRunner.h"
+#include "common/ThreadPool.h"
+#include <atomic>
+#include <map>
+#include <memory>
+#include <algorithm>
 
 class ImGuiLayer {
 public:
@@ -30,6 +36,19 @@ private:
     void cleanup();
     void assignPidColors();
 
+    // Comparación de algoritmos en segundo plano (una simulación por tarea)
+    struct ComparisonTask {
+        std::shared_ptr<std::atomic<float>> progress;   // fracción de procesos terminados
+        std::shared_ptr<std::atomic<bool>>  cancel;     // la tarea sale en el próximo evento
+        std::future<Metrics>                result;
+    };
+    std::pair<int, int> comparisonKey(SchedulingAlgo algo, int quantum) const;
+    void requestComparison(SchedulingAlgo algo, int quantum);
+    void pollComparisons();
+    // Cambió la configuración: descarta lo calculado y corta lo que sigue en
+    // el pool, así las comparaciones nuevas no esperan detrás de las viejas
+    void discardComparisons();
+
     // Punteros a los datos que se quiere mostrar o limpiar
     std::vector<Process>*  processes_;
     std::vector<Resource>* resources_;
@@ -40,9 +59,29 @@ private:
     const char* windowTitle;
     int winW, winH;
 
-    // motor de simulación y control
-    SimulationEngine engine_;
-    
-    bool            running_ = false;
-    float           speed_   = 1.0f;
+    // motor de simulación en su propio hilo; cada cuadro dibuja la última
+    // instantánea publicada
+    SimulationRunner runner_;
+    SimView          view_;
+
+    float           rate_    = 1.0f;    // ciclos por segundo
+    bool            maxRate_ = false;   // lo más rápido posible
+
+    // configuración pedida al motor (la instantánea la refleja un poco después)
+    int             quantum_     = 1;
+    int             boostPeriod_ = 100;
+    int             cores_       = 1;
+    CoreBalancing   balancing_   = CoreBalancing::GLOBAL;
+    SimMode         mode_        = SimMode::SCHEDULING;
+
+    // línea de tiempo: cada cuántos ciclos se guarda un checkpoint (0 = nunca;
+    // el motor los espacia más si llega a su tope)
+    static constexpr int DEFAULT_CHECKPOINT_INTERVAL = 25;
+    int             checkpointInterval_ = DEFAULT_CHECKPOINT_INTERVAL;
+
+    // resultados por (algoritmo, quantum); se calculan una vez por combinación
+    std::map<std::pair<int, int>, Metrics>        comparisonCache_;
+    std::map<std::pair<int, int>, ComparisonTask> comparisonTasks_;
+    std::atomic<bool> cancelWork_{false};
+    ThreadPool        workers_{ std::min(4u, std::max(1u, std::thread::hardware_concurrency())) };
 };